@@ -0,0 +1,175 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   arena.cc
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 17, 2026
+ *
+ *  Function        :   Arena (bump pointer) memory allocator
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+#include "arena.h"
+#include "../exception/exception.h"
+#include "../tempfile/tempfile.h"
+#include <unistd.h>
+
+// Alignment (in bytes) of all allocations
+#define CARENA_ALIGN        16
+
+/**
+ * spillDirectory
+ * Directory for temporary files of new blocks ("" = use the heap).
+ */
+CString CArena::spillDirectory = "";
+
+/**
+ * setSpillDirectory ()
+ * The function sets the directory in which new blocks are placed. An
+ * exception is thrown when no files can be created in the directory.
+ */
+void CArena::setSpillDirectory(const CString &dir)
+{
+    if (!dir.empty() && access(dir.c_str(), W_OK | X_OK) != 0)
+    {
+        throw CException("Cannot create temporary files in directory '"
+                            + dir + "'.");
+    }
+
+    spillDirectory = dir;
+}
+
+/**
+ * CArena ()
+ * Constructor.
+ */
+CArena::CArena(const CSize blockSz)
+{
+    blockSize = blockSz;
+    curBlock = 0;
+    curPos = 0;
+    allocated = 0;
+}
+
+/**
+ * ~CArena ()
+ * Destructor.
+ */
+CArena::~CArena()
+{
+    release();
+}
+
+/**
+ * alloc ()
+ * The function returns a pointer to sz bytes of memory. The memory is taken
+ * from the current block. When this block has not enough space left, the
+ * next block is used. A new block is allocated when no block is left that can
+ * hold the requested memory. This block is mapped from a temporary file when
+ * a spill directory is set.
+ */
+void *CArena::alloc(const CSize sz)
+{
+    CSize n = (sz + CARENA_ALIGN - 1) & ~((CSize)CARENA_ALIGN - 1);
+    CArenaBlock b;
+    void *p;
+
+    // Find a block with enough free space
+    while (curBlock < blocks.size() && curPos + n > blocks[curBlock].size)
+    {
+        curBlock++;
+        curPos = 0;
+    }
+
+    // No block left?
+    if (curBlock == blocks.size())
+    {
+        b.size = (n > blockSize ? n : blockSize);
+        b.mapped = !spillDirectory.empty();
+
+        if (b.mapped)
+        {
+            if (b.size < CARENA_SPILL_BLOCK_SIZE)
+                b.size = CARENA_SPILL_BLOCK_SIZE;
+
+            b.data = (char*)mapTempFile(spillDirectory, b.size);
+        }
+        else
+        {
+            b.data = new char [b.size];
+        }
+
+        blocks.push_back(b);
+        curPos = 0;
+    }
+
+    p = blocks[curBlock].data + curPos;
+    curPos += n;
+    allocated += n;
+
+    return p;
+}
+
+/**
+ * reset ()
+ * The function makes all memory of the arena available again. All pointers
+ * handed out by the arena become invalid. The blocks are kept.
+ */
+void CArena::reset()
+{
+    curBlock = 0;
+    curPos = 0;
+    allocated = 0;
+}
+
+/**
+ * release ()
+ * The function returns all blocks of the arena to the heap or removes their
+ * mapping.
+ */
+void CArena::release()
+{
+    for (CSize i = 0; i < blocks.size(); i++)
+    {
+        if (blocks[i].mapped)
+            unmapTempFile(blocks[i].data, blocks[i].size);
+        else
+            delete [] blocks[i].data;
+    }
+
+    blocks.clear();
+    reset();
+}
+
+/**
+ * capacity ()
+ * The function returns the number of bytes that are reserved by the arena.
+ */
+CSize CArena::capacity() const
+{
+    CSize sz = 0;
+
+    for (CSize i = 0; i < blocks.size(); i++)
+        sz += blocks[i].size;
+
+    return sz;
+}
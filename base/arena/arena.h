@@ -0,0 +1,122 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   arena.h
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 17, 2026
+ *
+ *  Function        :   Arena (bump pointer) memory allocator
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+#ifndef BASE_ARENA_ARENA_H_INCLUDED
+#define BASE_ARENA_ARENA_H_INCLUDED
+
+#include "../basic_types.h"
+#include "../string/cstring.h"
+
+// Default size (in bytes) of a block of the arena
+#define CARENA_BLOCK_SIZE   (1 << 20)
+
+// Minimal size (in bytes) of a block that is mapped from a temporary file
+#define CARENA_SPILL_BLOCK_SIZE (1 << 26)
+
+/**
+ * CArena
+ * Memory allocator which hands out memory from a small number of large
+ * blocks by advancing a pointer. Memory is never returned to the arena
+ * individually. Instead, all memory is made available again at once with
+ * reset(). The blocks are kept for later use, so an arena that is reset
+ * between runs of an algorithm does not touch the heap once it has grown to
+ * the size needed by the largest run. Objects placed in an arena should not
+ * need a destructor.
+ *
+ * When a spill directory is set, new blocks of all arenas are mapped from
+ * temporary files in this directory instead of allocated on the heap. The
+ * operating system then writes cold parts of an arena to disk when memory
+ * runs short and reads them back on demand, so state spaces can grow beyond
+ * the available memory.
+ */
+class CArena
+{
+public:
+    // Constructor
+    CArena(const CSize blockSz = CARENA_BLOCK_SIZE);
+
+    // Destructor
+    ~CArena();
+
+    // Allocate sz bytes
+    void *alloc(const CSize sz);
+
+    // Allocate an array of n elements of type T
+    template<class T> T *allocArray(const CSize n) {
+        return (T*)alloc(n * sizeof(T));
+    };
+
+    // Make all memory available again (blocks are kept)
+    void reset();
+
+    // Return all blocks to the heap (or remove their mapping)
+    void release();
+
+    // Number of bytes allocated since last reset
+    CSize size() const { return allocated; };
+
+    // Number of bytes reserved in blocks
+    CSize capacity() const;
+
+    // Directory for temporary files of new blocks ("" = use the heap)
+    static void setSpillDirectory(const CString &dir);
+    static const CString &getSpillDirectory() { return spillDirectory; };
+
+private:
+    // Copying an arena is not allowed
+    CArena(const CArena &a);
+    CArena &operator=(const CArena &a);
+
+    // Block of memory
+    typedef struct _CArenaBlock
+    {
+        char *data;
+        CSize size;
+        bool mapped;
+    } CArenaBlock;
+
+    // Blocks of the arena
+    vector<CArenaBlock> blocks;
+
+    // Block and offset in this block of the first free byte
+    CSize curBlock;
+    CSize curPos;
+
+    // Size of new blocks
+    CSize blockSize;
+
+    // Number of bytes allocated since last reset
+    CSize allocated;
+
+    // Directory for temporary files of new blocks
+    static CString spillDirectory;
+};
+
+#endif
@@ -70,4 +70,10 @@
 /* Sparse Matrices */
 #include "base/matrix/matrix.h"
 
+/* Arena allocator */
+#include "base/arena/arena.h"
+
+/* Threads */
+#include "base/thread/thread.h"
+
 #endif
@@ -32,68 +32,145 @@
  */
 
 #include "matrix.h"
+#include "../thread/thread.h"
+#include <algorithm>
 
 // Constructors
 
-SparseMatrix::SparseMatrix(const CId Size) {
+static bool SparseMatrixTripletBefore(const SparseMatrixTriplet& A, const SparseMatrixTriplet& B) {
 
-    Matrix.resize(Size);
-    
-    for (CId i = 0; i != Size; i++)
-        Matrix[i] = (SparseVector*) new SparseVector();
+	return A.Column < B.Column;
 }
 
-// Destructors
+CompressedSparseMatrix::CompressedSparseMatrix(SparseMatrixBuilder& Builder) {
 
-SparseVector::~SparseVector() {
+	NumberOfRows = Builder.getNumberOfRows();
+	NumberOfColumns = Builder.getNumberOfColumns();
 
-	while (Root->Next != NULL)
-		removeFirstElement();
-	
-	delete Root;
+	vector<SparseMatrixTriplet>& Triplets = Builder.getTriplets();
+
+	// Distribute triplets over rows
+
+	vector<CSize> Begin(NumberOfRows + 1, 0);
+
+	for (CSize k = 0; k != Triplets.size(); k++)
+		Begin[Triplets[k].Row + 1]++;
+
+	for (CId i = 0; i != NumberOfRows; i++)
+		Begin[i + 1] += Begin[i];
+
+	vector<SparseMatrixTriplet> Sorted(Triplets.size(), SparseMatrixTriplet(0, 0, 0));
+	vector<CSize> Position(Begin.begin(), Begin.end() - 1);
+
+	for (CSize k = 0; k != Triplets.size(); k++)
+		Sorted[Position[Triplets[k].Row]++] = Triplets[k];
+
+	// Sort each row on column and sum elements with equal column; zero sums are not stored
+
+	RowBegin.resize(NumberOfRows + 1);
+	Columns.reserve(Triplets.size());
+	Values.reserve(Triplets.size());
+
+	for (CId i = 0; i != NumberOfRows; i++) {
+
+		RowBegin[i] = Columns.size();
+
+		stable_sort(Sorted.begin() + Begin[i], Sorted.begin() + Begin[i + 1], SparseMatrixTripletBefore);
+
+		for (CSize k = Begin[i]; k != Begin[i + 1];) {
+
+			CId Column = Sorted[k].Column;
+			CDouble Value = 0;
+
+			for (; k != Begin[i + 1] && Sorted[k].Column == Column; k++)
+				Value += Sorted[k].Value;
+
+			if (Value != 0) {
+				Columns.push_back(Column);
+				Values.push_back(Value);
+			}
+		}
+	}
+
+	RowBegin[NumberOfRows] = Columns.size();
 }
 
-SparseMatrix::~SparseMatrix() {
+SparseMatrix::SparseMatrix(const CompressedSparseMatrix& M) {
+
+	Matrix.resize(M.getNumberOfRows());
+
+	for (CId i = 0; i != M.getNumberOfRows(); i++) {
 
-	for (CId i = 0; i != Matrix.size() - 1; i++)
-		delete Matrix[i];
+		Matrix[i].reserve(M.getRowEnd(i) - M.getRowBegin(i));
+
+		for (CSize k = M.getRowBegin(i); k != M.getRowEnd(i); k++)
+			Matrix[i].push_back(SparseVectorElement(M.getColumn(k), M.getValue(k)));
+	}
 }
 
 // Access to instance variables
 
-void SparseVector::addElement(const CId Index, const CDouble Value) {
-
-	SparseVectorElement* Element = new SparseVectorElement(Index, Value);
+CDouble CompressedSparseMatrix::get(const CId i, const CId j) const {
 
-	bool ElementAdded = false;
+	vector<CId>::const_iterator First = Columns.begin() + RowBegin[i];
+	vector<CId>::const_iterator Last = Columns.begin() + RowBegin[i + 1];
+	vector<CId>::const_iterator Element = lower_bound(First, Last, j);
 
-	SparseVectorElement* i = Root;
+	if (Element != Last && *Element == j)
+		return Values[Element - Columns.begin()];
 
-	for (i = Root; !ElementAdded && i->Next != NULL; i = i->Next)
-		if (i->Next->Index > Index) {
-			Element->Next = i->Next;
-			i->Next = Element;
-			ElementAdded = true;
-		}
-	
-	if (!ElementAdded)
-		i->Next = Element;
+	return 0;
 }
 
-SparseVectorElement* SparseVector::getElement(const CId Index) {
+// Function to multiply matrix with vector (y = M * x)
+
+typedef struct _SparseMatrixProduct {
+
+	const CompressedSparseMatrix* Matrix;
+	const vector<CDouble>* x;
+	vector<CDouble>* y;
+	CSize NumberOfBlocks;
+
+} SparseMatrixProduct;
+
+static void multiplySparseMatrixBlock(void* Arg, const CSize Block, const uint Thread) {
+
+	SparseMatrixProduct* P = (SparseMatrixProduct*)Arg;
+
+	const CompressedSparseMatrix* M = P->Matrix;
+	const vector<CDouble>& x = *P->x;
+	vector<CDouble>& y = *P->y;
+
+	CId First = Block * M->getNumberOfRows() / P->NumberOfBlocks;
+	CId Last = (Block + 1) * M->getNumberOfRows() / P->NumberOfBlocks;
+
+	for (CId i = First; i != Last; i++) {
+
+		CDouble Sum = 0;
 
-	for (SparseVectorElement* i = Root->Next; i != NULL; i = i->Next)
-		if (i->Index == Index)
-			return i;
+		for (CSize k = M->getRowBegin(i); k != M->getRowEnd(i); k++)
+			Sum += M->getValue(k) * x[M->getColumn(k)];
 
-	return NULL;
+		y[i] = Sum;
+	}
 }
 
-void SparseVector::removeFirstElement() {
+void CompressedSparseMatrix::multiply(const vector<CDouble>& x, vector<CDouble>& y, const uint NumberOfThreads) const {
+
+	y.resize(NumberOfRows);
+
+	SparseMatrixProduct P;
 
-	SparseVectorElement* Element = Root->Next;
-	Root->Next = Element->Next;
-	delete Element;
+	P.Matrix = this;
+	P.x = &x;
+	P.y = &y;
+	P.NumberOfBlocks = NumberOfThreads < 2 ? 1 : NumberOfThreads;
+
+	if (P.NumberOfBlocks > NumberOfRows)
+		P.NumberOfBlocks = NumberOfRows;
+
+	if (P.NumberOfBlocks != 0)
+		runParallelJobs(multiplySparseMatrixBlock, &P, P.NumberOfBlocks, NumberOfThreads);
 }
 
 // Function to compute eigen vector
@@ -111,96 +188,80 @@ vector<CDouble> SparseMatrix::computeEigenVector() {
 
 		// Find row j with maximum element starting from row i - postpone using last row as much as possible
 
-		CDouble Maximum = Matrix[i]->getFirstElement()->Value;
+		CDouble Maximum = Matrix[i].front().Value;
 		CId Index = i;
 
 		bool NonZeroElementFound = false;
 
 		for (CId j = i + 1; j != Matrix.size() - 1; j++) {
 	
-			SparseVectorElement* Element = Matrix[j]->getFirstElement();
+			SparseVectorElement& Element = Matrix[j].front();
 	
-			if (Element->Index == i) {
+			if (Element.Index == i) {
 				
 				NonZeroElementFound = true;
 				
-				if (fabs(Element->Value) > fabs(Maximum)) {
-					Maximum = Element->Value;
+				if (fabs(Element.Value) > fabs(Maximum)) {
+					Maximum = Element.Value;
 					Index = j;
 				}
 			}
 		}
 
 		if (!NonZeroElementFound) {
-			Maximum = Matrix[Matrix.size() - 1]->getFirstElement()->Value;
+			Maximum = Matrix[Matrix.size() - 1].front().Value;
 			Index = Matrix.size() - 1;
 		}
 
-		// Swap current row i with row that has maximum element (if necessary) and division by that element
+		// Swap current row i with row that has maximum element (if necessary)
 
-		if (Index != i) {
-			SparseVector* Temp = Matrix[i];
-			Matrix[i] = Matrix[Index];
-			Matrix[Index] = Temp;
-		}
+		if (Index != i)
+			Matrix[i].swap(Matrix[Index]);
 
-		// Subtraction of rows
+		// Subtraction of rows - merge the remainder of both rows into a new row without the element in column i
 
-		SparseVectorElement* FirstElementOfRow = Matrix[i]->getFirstElement();
+		SparseVector& Row = Matrix[i];
+		SparseVector Result;
 
 		for (CId j = i + 1; j != Matrix.size(); j++) {
 			
-			SparseVectorElement* Element = Matrix[j]->getFirstElement();
+			SparseVector& RowToChange = Matrix[j];
 
-			if (Element->Index == i) {
+			if (RowToChange.front().Index == i) {
 			
-				CDouble Factor = -Element->Value / Maximum;
+				CDouble Factor = -RowToChange.front().Value / Maximum;
 
-				SparseVectorElement* PreviouslyAccessedElement = Element;
+				Result.clear();
+				Result.reserve(RowToChange.size() + Row.size());
 
-				for (SparseVectorElement* ElementOfRow = FirstElementOfRow->Next; ElementOfRow != NULL;) {
+				SparseVector::iterator ElementToChange = RowToChange.begin() + 1;
+				SparseVector::iterator ElementOfRow = Row.begin() + 1;
 
-					SparseVectorElement* ElementToChange = PreviouslyAccessedElement->Next;
+				while (ElementToChange != RowToChange.end() || ElementOfRow != Row.end()) {
 
-					if (ElementToChange != NULL) {
+					if (ElementOfRow == Row.end() || (ElementToChange != RowToChange.end() && ElementToChange->Index < ElementOfRow->Index)) {
 
-						if (ElementToChange->Index == ElementOfRow->Index) {
+						Result.push_back(*ElementToChange);
+						ElementToChange++;
 
-							ElementToChange->Value = ElementToChange->Value + Factor * ElementOfRow->Value;
-						
-							if (ElementToChange->Value == 0) {
-								PreviouslyAccessedElement->Next = ElementToChange->Next;
-								delete ElementToChange;
-							} else
-								PreviouslyAccessedElement = ElementToChange;
-						
-							 ElementOfRow = ElementOfRow->Next;
+					} else if (ElementToChange == RowToChange.end() || ElementToChange->Index > ElementOfRow->Index) {
 
-						} else if (ElementToChange->Index > ElementOfRow->Index) {
-						
-							SparseVectorElement* NewElement = new SparseVectorElement(ElementOfRow->Index, Factor * ElementOfRow->Value);
-						
-							NewElement->Next = ElementToChange;
-							PreviouslyAccessedElement->Next = NewElement;
-							PreviouslyAccessedElement = NewElement;
+						Result.push_back(SparseVectorElement(ElementOfRow->Index, Factor * ElementOfRow->Value));
+						ElementOfRow++;
 
-							ElementOfRow = ElementOfRow->Next;
-
-						} else
-							PreviouslyAccessedElement = ElementToChange;
 					} else {
-					
-						SparseVectorElement* NewElement = new SparseVectorElement(ElementOfRow->Index, Factor * ElementOfRow->Value);
-						
-						NewElement->Next = ElementToChange;
-						PreviouslyAccessedElement->Next = NewElement;
-						PreviouslyAccessedElement = NewElement;
-						
-						ElementOfRow = ElementOfRow->Next;
+
+						CDouble Value = ElementToChange->Value + Factor * ElementOfRow->Value;
+
+						if (Value != 0)
+							Result.push_back(SparseVectorElement(ElementToChange->Index, Value));
+
+						ElementToChange++;
+						ElementOfRow++;
 					}
 				}
 
-				Matrix[j]->removeFirstElement();
+				RowToChange.swap(Result);
 			}
 		}
 	}
@@ -212,21 +273,15 @@ vector<CDouble> SparseMatrix::computeEigenVector() {
 	for (CId i = Matrix.size() - 1; i + 1 != 0; i--) {
 	
 		CDouble Sum = 0;
+		CDouble Value = 0;
 		
-		if (i < Matrix.size() - 1)
-			for (SparseVectorElement* ElementOfRow = Matrix[i]->getFirstElement()->Next; ElementOfRow != NULL; ElementOfRow = ElementOfRow->Next)
-				if (ElementOfRow->Index < Matrix.size())
-					Sum += ElementOfRow->Value * EigenVector[ElementOfRow->Index];
-
-		CDouble Result;
-		SparseVectorElement* Element = Matrix[i]->getElement(Matrix.size());
-
-		if (Element != NULL)
-			Result = (Element->Value - Sum) / Matrix[i]->getFirstElement()->Value;
-		else
-			Result = -Sum / Matrix[i]->getFirstElement()->Value;
+		for (SparseVector::iterator Element = Matrix[i].begin(); Element != Matrix[i].end(); Element++)
+			if (Element->Index == Matrix.size())
+				Value = Element->Value;
+			else if (i < Matrix.size() - 1 && Element != Matrix[i].begin())
+				Sum += Element->Value * EigenVector[Element->Index];
 
-		EigenVector[i] = Result;
+		EigenVector[i] = (Value - Sum) / Matrix[i].front().Value;
 	}
 
     return EigenVector;
@@ -37,62 +37,106 @@
 #include "../basic_types.h"
 #include <cmath>
 
-class SparseVectorElement;
-
 class SparseVectorElement {
 
 public:
 	// Constructor
 
-	SparseVectorElement() { Next = NULL; };
-	SparseVectorElement(const CId I, const CDouble V) { Index = I; Value = V; Next = NULL; };
+	SparseVectorElement() { Index = 0; Value = 0; };
+	SparseVectorElement(const CId I, const CDouble V) { Index = I; Value = V; };
 	
 	// Instance Variables
 
 	CId Index;
 	CDouble Value;
-	SparseVectorElement* Next;
 };
 
-class SparseVector {
+// Elements of a sparse vector are stored consecutively in increasing order of index
+
+typedef vector<SparseVectorElement> SparseVector;
+
+// Element of a matrix under construction
+
+class SparseMatrixTriplet {
 
 public:
 	// Constructor
-	
-	SparseVector() { Root = new SparseVectorElement(); };
-	
-	// Destructor
-	
-	~SparseVector();
-	
+
+	SparseMatrixTriplet(const CId R, const CId C, const CDouble V) { Row = R; Column = C; Value = V; };
+
+	// Instance Variables
+
+	CId Row;
+	CId Column;
+	CDouble Value;
+};
+
+class SparseMatrixBuilder {
+
+public:
+	// Constructor
+
+	SparseMatrixBuilder(const CId Rows, const CId Columns) { NumberOfRows = Rows; NumberOfColumns = Columns; };
+
+	// Access to elements (values added to the same element are summed)
+
+	void add(const CId i, const CId j, const CDouble Value) { Triplets.push_back(SparseMatrixTriplet(i, j, Value)); };
+	void reserve(const CSize NumberOfElements) { Triplets.reserve(NumberOfElements); };
+
+	CId getNumberOfRows() const { return NumberOfRows; };
+	CId getNumberOfColumns() const { return NumberOfColumns; };
+	vector<SparseMatrixTriplet>& getTriplets() { return Triplets; };
+
+private:
+	// Instance Variables
+
+	CId NumberOfRows;
+	CId NumberOfColumns;
+	vector<SparseMatrixTriplet> Triplets;
+};
+
+class CompressedSparseMatrix {
+
+public:
+	// Constructor (sorts and compresses the elements of the builder)
+
+	CompressedSparseMatrix(SparseMatrixBuilder& Builder);
+
 	// Access to elements
 
-	void addElement(const CId Index, const CDouble Value);
-	SparseVectorElement* getElement(const CId Index);
-	SparseVectorElement* getFirstElement() { return Root->Next; };
-	void removeFirstElement();
+	CId getNumberOfRows() const { return NumberOfRows; };
+	CId getNumberOfColumns() const { return NumberOfColumns; };
+	CSize getNumberOfElements() const { return Columns.size(); };
+
+	// Elements of row i are the positions getRowBegin(i) up to getRowEnd(i)
+
+	CSize getRowBegin(const CId i) const { return RowBegin[i]; };
+	CSize getRowEnd(const CId i) const { return RowBegin[i + 1]; };
+	CId getColumn(const CSize Position) const { return Columns[Position]; };
+	CDouble getValue(const CSize Position) const { return Values[Position]; };
+
+	CDouble get(const CId i, const CId j) const;
+
+	// Functions
+
+	void multiply(const vector<CDouble>& x, vector<CDouble>& y, const uint NumberOfThreads = 1) const;
 
 private:
 	// Instance Variables
 
-	SparseVectorElement* Root;
+	CId NumberOfRows;
+	CId NumberOfColumns;
+	vector<CSize> RowBegin;
+	vector<CId> Columns;
+	vector<CDouble> Values;
 };
 
 class SparseMatrix {
 
 public:
-    // Constructor
-    
-    SparseMatrix(const CId Size);
+    // Constructor (augmented matrix with one more column than rows)
     
-    // Destructor
-
-    ~SparseMatrix();
-    
-    // Access to elements
-
-    void set(const CId i, const CId j, const CDouble Value) { if (Matrix[i]->getElement(j) == NULL) Matrix[i]->addElement(j, Value); else Matrix[i]->getElement(j)->Value = Value; };
-    CDouble get(const CId i, const CId j) { return (Matrix[i]->getElement(j) == NULL) ? 0 : Matrix[i]->getElement(j)->Value; };
+    SparseMatrix(const CompressedSparseMatrix& M);
     
     // Functions
     
@@ -101,7 +145,7 @@ public:
 private:
     // Instance Variables;
     
-    vector<SparseVector*> Matrix;
+    vector<SparseVector> Matrix;
 };
 
 #endif
@@ -34,7 +34,10 @@
  */
  
 #include "tempfile.h"
+#include "../exception/exception.h"
 #include <cstdlib>
+#include <unistd.h>
+#include <sys/mman.h>
 
 /**
  * tempFileName ()
@@ -51,3 +54,54 @@ CString tempFileName(const CString &dir, const CString &prefix)
     
     return nameStr;
 }
+
+/**
+ * mapTempFile ()
+ * The function maps a new temporary file of sz bytes in the directory dir
+ * into memory. The file is removed from the directory immediately, so its
+ * space is returned when the mapping is removed or the program ends.
+ */
+void *mapTempFile(const CString &dir, const CSize sz)
+{
+    CString templ = dir + "/sdf3XXXXXX";
+    char *nameBuf = new char [templ.length() + 1];
+    CString name;
+    void *p;
+    int fd;
+
+    // Unlike tempnam, mkstemp never falls back to another directory
+    templ.copy(nameBuf, templ.length());
+    nameBuf[templ.length()] = '\0';
+    fd = mkstemp(nameBuf);
+    name = CString(nameBuf);
+    delete [] nameBuf;
+
+    if (fd == -1)
+        throw CException("Failed creating temporary file in '" + dir + "'.");
+
+    unlink(name.c_str());
+
+    // The file is sparse, disk space is only used for pages written to it
+    if (ftruncate(fd, sz) != 0)
+    {
+        close(fd);
+        throw CException("Failed extending temporary file '" + name + "'.");
+    }
+
+    p = mmap(NULL, sz, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (p == MAP_FAILED)
+        throw CException("Failed mapping temporary file '" + name + "'.");
+
+    return p;
+}
+
+/**
+ * unmapTempFile ()
+ * The function removes a mapping created with mapTempFile.
+ */
+void unmapTempFile(void *p, const CSize sz)
+{
+    munmap(p, sz);
+}
@@ -36,6 +36,7 @@
 #ifndef BASE_FSTREAM_TEMPFILE_H_INCLUDED
 #define BASE_FSTREAM_TEMPFILE_H_INCLUDED
 
+#include "../basic_types.h"
 #include "../string/cstring.h"
 
 /**
@@ -44,4 +45,20 @@
  */
 CString tempFileName(const CString &dir, const CString &prefix);
 
+/**
+ * mapTempFile ()
+ * The function maps a new temporary file of sz bytes in the directory dir
+ * into memory. The file is removed from the directory immediately, so its
+ * space is returned when the mapping is removed or the program ends. The
+ * operating system writes pages of the mapping to the file when memory runs
+ * short and reads them back on demand.
+ */
+void *mapTempFile(const CString &dir, const CSize sz);
+
+/**
+ * unmapTempFile ()
+ * The function removes a mapping created with mapTempFile.
+ */
+void unmapTempFile(void *p, const CSize sz);
+
 #endif
@@ -0,0 +1,281 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   thread.cc
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 17, 2026
+ *
+ *  Function        :   Parallel execution of independent jobs
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+#include "thread.h"
+#include "../exception/exception.h"
+
+#include <pthread.h>
+#include <unistd.h>
+
+/**
+ * CThreadPool
+ * Administration of the worker threads and of the set of jobs they execute.
+ * The workers are started once and are kept waiting for the next set of jobs,
+ * so the cost of creating threads is not paid on every call. Worker w runs
+ * as thread w, the thread that calls runParallelJobs runs as thread 0. All
+ * fields are protected by the lock.
+ */
+typedef struct _CThreadPool
+{
+    // Set of jobs
+    CThreadJob job;
+    void *arg;
+    CSize nrJobs;
+    CSize nextJob;
+    bool failed;
+    CString error;
+
+    // Number of threads executing the set of jobs and number of workers
+    // that are still executing jobs from the set
+    uint nrThreads;
+    uint nrBusy;
+
+    // Sequence number of the set of jobs
+    unsigned long generation;
+
+    // Number of workers that are started
+    uint nrWorkers;
+
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t done;
+} CThreadPool;
+
+static CThreadPool pool;
+static pthread_once_t poolInitialized = PTHREAD_ONCE_INIT;
+
+/**
+ * poolInUse
+ * Lock held by the caller of runParallelJobs while the pool executes its
+ * jobs. A nested or concurrent call which cannot take it executes its jobs on
+ * the calling thread.
+ */
+static pthread_mutex_t poolInUse = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * initPool ()
+ * The function initializes the pool without any workers.
+ */
+static
+void initPool()
+{
+    pool.nrThreads = 0;
+    pool.nrBusy = 0;
+    pool.generation = 0;
+    pool.nrWorkers = 0;
+    pthread_mutex_init(&pool.lock, NULL);
+    pthread_cond_init(&pool.start, NULL);
+    pthread_cond_init(&pool.done, NULL);
+}
+
+/**
+ * failPool ()
+ * The function marks the pool as failed. Only the first error is kept.
+ */
+static
+void failPool(const CString &error)
+{
+    pthread_mutex_lock(&pool.lock);
+    if (!pool.failed)
+    {
+        pool.failed = true;
+        pool.error = error;
+    }
+    pthread_mutex_unlock(&pool.lock);
+}
+
+/**
+ * executeJobs ()
+ * The function takes jobs from the pool till no jobs are left or a job has
+ * failed. The jobs are executed as the given thread.
+ */
+static
+void executeJobs(const uint thread)
+{
+    CSize job;
+
+    while (true)
+    {
+        // Take the next job from the pool
+        pthread_mutex_lock(&pool.lock);
+        if (pool.failed || pool.nextJob == pool.nrJobs)
+        {
+            pthread_mutex_unlock(&pool.lock);
+            break;
+        }
+        job = pool.nextJob++;
+        pthread_mutex_unlock(&pool.lock);
+
+        // Execute the job
+        try
+        {
+            pool.job(pool.arg, job, thread);
+        }
+        catch (CException &e)
+        {
+            failPool(e.getMessage());
+        }
+        catch (...)
+        {
+            failPool("Job failed with an unknown exception.");
+        }
+    }
+}
+
+/**
+ * runWorker ()
+ * The function executed by every worker thread. It waits for a new set of
+ * jobs and helps executing it when the worker is one of the threads that
+ * are requested for the set.
+ */
+static
+void *runWorker(void *arg)
+{
+    const uint thread = (uint)(size_t)(arg);
+    unsigned long generation = 0;
+
+    while (true)
+    {
+        // Wait for a new set of jobs
+        pthread_mutex_lock(&pool.lock);
+        while (pool.generation == generation)
+            pthread_cond_wait(&pool.start, &pool.lock);
+        generation = pool.generation;
+
+        if (thread >= pool.nrThreads)
+        {
+            pthread_mutex_unlock(&pool.lock);
+            continue;
+        }
+        pthread_mutex_unlock(&pool.lock);
+
+        executeJobs(thread);
+
+        // Last worker to finish wakes the caller
+        pthread_mutex_lock(&pool.lock);
+        pool.nrBusy--;
+        if (pool.nrBusy == 0)
+            pthread_cond_signal(&pool.done);
+        pthread_mutex_unlock(&pool.lock);
+    }
+
+    return NULL;
+}
+
+/**
+ * runParallelJobs ()
+ * The function executes the jobs 0 up to nrJobs-1 using nrThreads threads.
+ * Jobs are handed out in increasing order to the first thread that becomes
+ * idle. The function returns when all jobs are completed. When nrThreads is
+ * smaller then two, all jobs are executed in order on the calling thread. An
+ * exception thrown by a job is passed on to the caller once all threads
+ * have stopped. Exceptions other than a CException are passed on as a
+ * CException.
+ */
+void runParallelJobs(CThreadJob job, void *arg, const CSize nrJobs,
+        const uint nrThreads)
+{
+    CString error;
+    bool failed;
+    uint n;
+
+    // Sequential execution (also when the pool is already in use)
+    if (nrThreads < 2 || nrJobs < 2 || pthread_mutex_trylock(&poolInUse) != 0)
+    {
+        for (CSize i = 0; i < nrJobs; i++)
+            job(arg, i, 0);
+        return;
+    }
+
+    pthread_once(&poolInitialized, initPool);
+
+    // No more threads then jobs
+    n = (nrJobs < nrThreads ? (uint)nrJobs : nrThreads);
+
+    // Start the workers which are missing. When a worker cannot be created,
+    // the jobs are executed by the threads that are available.
+    pthread_mutex_lock(&pool.lock);
+    while (pool.nrWorkers + 1 < n)
+    {
+        pthread_t worker;
+
+        if (pthread_create(&worker, NULL, runWorker, 
+                    (void*)(size_t)(pool.nrWorkers + 1)) != 0)
+        {
+            n = pool.nrWorkers + 1;
+            break;
+        }
+        pthread_detach(worker);
+        pool.nrWorkers++;
+    }
+
+    // Hand the set of jobs to the workers
+    pool.job = job;
+    pool.arg = arg;
+    pool.nrJobs = nrJobs;
+    pool.nextJob = 0;
+    pool.failed = false;
+    pool.error = "";
+    pool.nrThreads = n;
+    pool.nrBusy = n - 1;
+    pool.generation++;
+    pthread_cond_broadcast(&pool.start);
+    pthread_mutex_unlock(&pool.lock);
+
+    // The calling thread executes jobs as thread 0
+    executeJobs(0);
+
+    // Wait till all workers are done
+    pthread_mutex_lock(&pool.lock);
+    while (pool.nrBusy != 0)
+        pthread_cond_wait(&pool.done, &pool.lock);
+    failed = pool.failed;
+    error = pool.error;
+    pthread_mutex_unlock(&pool.lock);
+
+    pthread_mutex_unlock(&poolInUse);
+
+    if (failed)
+        throw CException(error);
+}
+
+/**
+ * nrProcessorsOnline ()
+ * The function returns the number of processors that are available.
+ */
+uint nrProcessorsOnline()
+{
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (n < 1)
+        return 1;
+
+    return (uint)n;
+}
@@ -0,0 +1,67 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   thread.h
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 17, 2026
+ *
+ *  Function        :   Parallel execution of independent jobs
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+#ifndef BASE_THREAD_THREAD_H_INCLUDED
+#define BASE_THREAD_THREAD_H_INCLUDED
+
+#include "../basic_types.h"
+
+/**
+ * CThreadJob
+ * Function which executes a single job. The function is called with the
+ * argument supplied to runParallelJobs, the index of the job and the index of
+ * the thread which executes the job. Jobs which run on the same thread never
+ * run concurrently, so the thread index can be used to select data which is
+ * private to a thread.
+ */
+typedef void (*CThreadJob)(void *arg, const CSize job, const uint thread);
+
+/**
+ * runParallelJobs ()
+ * The function executes the jobs 0 up to nrJobs-1 using nrThreads threads.
+ * Jobs are handed out in increasing order to the first thread that becomes
+ * idle. The function returns when all jobs are completed. When nrThreads is
+ * smaller then two, all jobs are executed in order on the calling thread. An
+ * exception thrown by a job is passed on to the caller once all threads
+ * have stopped. The calling thread executes jobs as thread 0. The other
+ * threads are started by the first call that needs them and are reused by
+ * later calls. A call made while another call is executing its jobs (e.g.
+ * from within a job) executes all its jobs in order on the calling thread.
+ */
+void runParallelJobs(CThreadJob job, void *arg, const CSize nrJobs,
+        const uint nrThreads);
+
+/**
+ * nrProcessorsOnline ()
+ * The function returns the number of processors that are available.
+ */
+uint nrProcessorsOnline();
+
+#endif
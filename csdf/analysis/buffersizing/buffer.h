@@ -40,6 +40,7 @@
 
 #include "sdf/sdf.h"
 #include "../../base/timed/graph.h"
+#include "sdf/analysis/statespace/state.h"
 
 /**
  * Throughput / storage-space trade-off exploration
@@ -107,6 +108,9 @@ private:
             // Clear state
             void clear();
 
+            // Encode the state into a compact state
+            void pack(SDFcompactState &s) const;
+
             // Output state
             void print(ostream &out);
 
@@ -118,9 +122,8 @@ private:
             unsigned long glbClk;
         };
 
-        // Sequence of states in transition system        
-        typedef list<State>      States;
-        typedef States::iterator StatesIter;
+        // Position of a state in the transition system
+        typedef SDFstatePos StatesIter;
 
         // Constructor
         TransitionSystem(TimedCSDFgraph *gr) {
@@ -171,8 +174,11 @@ private:
         State currentState; 
         State previousState;
 
-        // List of visited states that are stored
-        States storedStates;
+        // Visited states that are stored
+        SDFstateStore storedStates;
+
+        // Encoding of the state which is being stored
+        SDFcompactState encodedState;
     };
     
     // Bounds on the search space
@@ -37,6 +37,7 @@
 #define CSDF_ANALYSIS_STATESPACE_SELFTIMED_THROUGHPUT_H_INCLUDED
 
 #include "../../base/timed/graph.h"
+#include "sdf/analysis/statespace/state.h"
 
 /**
  * Throughput analysis
@@ -92,6 +93,9 @@ private:
             // Clear state
             void clear();
 
+            // Encode the state into a compact state
+            void pack(SDFcompactState &s) const;
+
             // Output state
             void print(ostream &out);
 
@@ -102,9 +106,8 @@ private:
             unsigned long glbClk;
         };
 
-        // Sequence of states in transition system        
-        typedef list<State>      States;
-        typedef States::iterator StatesIter;
+        // Position of a state in the transition system
+        typedef SDFstatePos StatesIter;
 
         // Constructor
         TransitionSystem(TimedCSDFgraph *gr) {
@@ -147,8 +150,11 @@ private:
         State currentState; 
         State previousState;
 
-        // List of visited states that are stored
-        States storedStates;
+        // Visited states that are stored
+        SDFstateStore storedStates;
+
+        // Encoding of the state which is being stored
+        SDFcompactState encodedState;
     };
 };
 
@@ -60,6 +60,9 @@ typedef struct _Settings
     
     // Switch argument(s) given to analysis algorithm
     CPairs arguments;
+
+    // Directory for temporary files holding large state spaces ("" = memory)
+    CString spillDir;
     
     // Application graph
     CNode *xmlAppGraph;
@@ -80,10 +83,12 @@ void helpMessage(ostream &out)
     out << "SDF3 " << TOOL << " (version " << DOTTED_VERSION ")" << endl;
     out << endl;
     out << "Usage: " << TOOL << " --graph <file> --algo <algorithm>";
-    out << " [--output <file>]";
+    out << " [--output <file>] [--spill <dir>]";
     out << endl;
     out << "   --graph  <file>     input CSDF graph" << endl;
     out << "   --output <file>     output file (default: stdout)" << endl;
+    out << "   --spill <dir>       keep state spaces in temporary files in <dir>";
+    out << endl;
     out << "   --algo <algorithm>  analyze the graph with requested algorithm:";
     out << endl;
     out << "       consistency" << endl;              
@@ -197,6 +202,11 @@ void parseCommandLine(int argc, char ** argv)
             arg++;
             settings.arguments = parseSwitchArgument(argv[arg]);
         }
+        else if (argv[arg] == CString("--spill") && arg+1<argc)
+        {
+            arg++;
+            settings.spillDir = argv[arg];
+        }
         else
         {
             helpMessage(cerr);
@@ -248,6 +258,9 @@ void initSettings(int argc, char **argv)
     // Parse the command line
     parseCommandLine(argc, argv);
 
+    // State spaces are paged to disk when memory runs short
+    CArena::setSpillDirectory(settings.spillDir);
+
     // Check required settings
     if (settings.graphFile.empty() || settings.arguments.size() == 0)
     {
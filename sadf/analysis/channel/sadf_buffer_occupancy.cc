@@ -99,7 +99,7 @@ void SADF_ConstructTPS_BufferOccupancy(SADF_Graph* Graph, SADF_TPS* TPS, SADF_Co
 
 // Function to analyse long-run buffer occupancy
 
-CSize SADF_Analyse_LongRunBufferOccupancy(SADF_Graph* Graph, CId ChannelType, CId ChannelID, CDouble& Average, CDouble& Variance) {
+CSize SADF_Analyse_LongRunBufferOccupancy(SADF_Graph* Graph, CId ChannelType, CId ChannelID, CDouble& Average, CDouble& Variance, const CDouble Tolerance, const uint NumberOfThreads) {
 
 	// Check whether graph satisfied required properties
 
@@ -146,7 +146,7 @@ CSize SADF_Analyse_LongRunBufferOccupancy(SADF_Graph* Graph, CId ChannelType, CI
 
 	CSize NumberOfConfigurations = TPS->getNumberOfConfigurations();
 
-    vector<CDouble> EquilibriumDistribution = TPS->computeEquilibriumDistribution();
+    vector<CDouble> EquilibriumDistribution = TPS->computeEquilibriumDistribution(Tolerance, NumberOfThreads);
 
 	// Compute results
 
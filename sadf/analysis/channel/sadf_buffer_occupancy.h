@@ -46,7 +46,7 @@
 
 // Functions to analyse buffer occupancy (returns number of stored states)
 
-CSize SADF_Analyse_LongRunBufferOccupancy(SADF_Graph* Graph, CId ChannelType, CId ChannelID, CDouble& Average, CDouble& Variance);
+CSize SADF_Analyse_LongRunBufferOccupancy(SADF_Graph* Graph, CId ChannelType, CId ChannelID, CDouble& Average, CDouble& Variance, const CDouble Tolerance = SADF_DEFAULT_TOLERANCE, const uint NumberOfThreads = 1);
 CSize SADF_Analyse_MaximumBufferOccupancy(SADF_Graph* Graph, CId ChannelType, CId ChannelID, CDouble& Maximum);
 //CSize SADF_Analyse_BufferSize(SADF_Graph* Graph, CId ChannelType, CId ChannelID, CDouble& Result);
 
@@ -0,0 +1,151 @@
+/*
+ *  Eindhoven University of Technology
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   sadf_long_run_metrics.cc
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   17 October 2026
+ *
+ *  Function        :   Analysis of long-run metrics from a single TPS
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ * 
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+#include "sadf_long_run_metrics.h"
+
+// Function to progress TPS while recording rewards for all long-run metrics
+
+SADF_ListOfConfigurations SADF_ProgressTPS_LongRunMetrics(SADF_Graph* Graph, SADF_TPS* TPS, SADF_Configuration* Source) {
+
+	CId NumberOfProcesses = Graph->getNumberOfKernels() + Graph->getNumberOfDetectors();
+	CId NumberOfChannels = Graph->getNumberOfDataChannels() + Graph->getNumberOfControlChannels();
+
+	SADF_Process* Actor;
+	SADF_ListOfConfigurations NewConfigurations = SADF_ProgressTPS_ASAP_Resolved(Graph, TPS, Source, Actor);
+
+	// Rewards: time elapsed in the step, completed firing of each process and occupation of each channel
+
+	Source->initialiseLocalResults(1 + NumberOfProcesses + NumberOfChannels);
+
+	if (Actor == NULL)
+		Source->setLocalResult(0, Source->getMinimalRemainingExecutionTime());
+	else if (Source->getTransitions().front()->getDestination()->getType() == SADF_END_STEP) {
+		if (Actor->getType() == SADF_KERNEL)
+			Source->setLocalResult(1 + Actor->getIdentity(), 1);
+		else
+			Source->setLocalResult(1 + Graph->getNumberOfKernels() + Actor->getIdentity(), 1);
+	}
+
+	for (CId i = 0; i != Graph->getNumberOfDataChannels(); i++)
+		Source->setLocalResult(1 + NumberOfProcesses + i, Source->getChannelStatus(i)->getOccupation());
+
+	for (CId i = 0; i != Graph->getNumberOfControlChannels(); i++)
+		Source->setLocalResult(1 + NumberOfProcesses + Graph->getNumberOfDataChannels() + i, Source->getControlStatus(i)->getOccupation());
+
+	return NewConfigurations;
+}
+
+// Function to analyse long-run metrics
+
+CSize SADF_Analyse_LongRunMetrics(SADF_Graph* Graph, vector<CDouble>& Throughput, vector<CDouble>& AverageBufferOccupancy, vector<CDouble>& VarianceBufferOccupancy, const CDouble Tolerance, const uint NumberOfThreads) {
+
+	// Check whether graph satisfied required properties
+
+	if (!SADF_Verify_SingleComponent(Graph))
+		throw CException((CString)("Error: SADF graph '") + Graph->getName() + "' does not consist of a single component.");
+
+	if (!SADF_Verify_Timed(Graph))
+		throw CException((CString)("Error: SADF graph '") + Graph->getName() + "' is not timed.");
+	
+	if (!SADF_Verify_Boundedness(Graph))
+		throw CException((CString)("Error: SADF graph '") + Graph->getName() + "' is not bounded.");
+
+	bool Ergodic = SADF_Verify_SimpleErgodicity(Graph);	// Only in case Ergodic is true, the SADF graph is ergodic for sure. Otherwise, ergodicity test needed after generating TPS
+
+	// Construct TPS
+
+	SADF_TPS* TPS = new SADF_TPS(Graph);
+	SADF_ConstructTPS_Parallel(Graph, TPS, TPS->getInitialConfiguration(), SADF_ProgressTPS_LongRunMetrics, NumberOfThreads);
+
+	TPS->deleteContentOfConfigurations();
+	TPS->removeTransientConfigurations();
+
+	if (!Ergodic)
+		if (!TPS->isSingleStronglyConnectedComponent())
+			throw CException((CString)("Error: SADF graph '") + Graph->getName() + "' does not imply an ergodic Markov chain.");
+
+	CSize NumberOfConfigurations = TPS->getNumberOfConfigurations();
+
+    vector<CDouble> EquilibriumDistribution = TPS->computeEquilibriumDistribution(Tolerance, NumberOfThreads);
+
+	// Compute expected rewards per step
+
+	CId NumberOfProcesses = Graph->getNumberOfKernels() + Graph->getNumberOfDetectors();
+	CId NumberOfChannels = Graph->getNumberOfDataChannels() + Graph->getNumberOfControlChannels();
+
+	CDouble AverageTime = 0;
+	vector<CDouble> Firings(NumberOfProcesses, 0);
+	vector<CDouble> AverageOccupation(NumberOfChannels, 0);
+	vector<CDouble> AverageSquaredOccupation(NumberOfChannels, 0);
+
+	for (SADF_HashedListOfConfigurations::iterator i = TPS->getConfigurationSpace().begin(); i != TPS->getConfigurationSpace().end(); i++)
+		for (SADF_ListOfConfigurations::iterator j = (*i).begin(); j != (*i).end(); j++) {
+
+			CDouble Probability = EquilibriumDistribution[(*j)->getIdentity()];
+			CDouble Temp = Probability * (*j)->getLocalResult(0);
+
+			AverageTime += Temp;
+
+			for (CId p = 0; p != NumberOfProcesses; p++)
+				Firings[p] += Probability * (*j)->getLocalResult(1 + p);
+
+			for (CId c = 0; c != NumberOfChannels; c++) {
+				CDouble Occupation = (*j)->getLocalResult(1 + NumberOfProcesses + c);
+				AverageOccupation[c] += Temp * Occupation;
+				AverageSquaredOccupation[c] += Temp * Occupation * Occupation;
+			}
+		}
+
+	delete TPS;
+
+	if (AverageTime == 0)
+		throw CException((CString)("Error: SADF graph '") + Graph->getName() + "' does not perform any scenarios in the long-run that imply progress in time.");
+
+	// Compute results as ratios of expected rewards
+
+	Throughput.resize(NumberOfProcesses);
+
+	for (CId p = 0; p != NumberOfProcesses; p++)
+		Throughput[p] = Firings[p] / AverageTime;
+
+	AverageBufferOccupancy.resize(NumberOfChannels);
+	VarianceBufferOccupancy.resize(NumberOfChannels);
+
+	for (CId c = 0; c != NumberOfChannels; c++) {
+
+		AverageBufferOccupancy[c] = AverageOccupation[c] / AverageTime;
+		VarianceBufferOccupancy[c] = (AverageSquaredOccupation[c] / AverageTime) - (AverageBufferOccupancy[c] * AverageBufferOccupancy[c]);
+
+		if (VarianceBufferOccupancy[c] < 0)
+			VarianceBufferOccupancy[c] = 0;		// Circumvent rounding errors;
+	}
+
+	return NumberOfConfigurations;
+}
@@ -0,0 +1,50 @@
+/*
+ *  Eindhoven University of Technology
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   sadf_long_run_metrics.h
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   17 October 2026
+ *
+ *  Function        :   Analysis of long-run metrics from a single TPS
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ * 
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+#ifndef SADF_LONG_RUN_METRICS_H_INCLUDED
+#define SADF_LONG_RUN_METRICS_H_INCLUDED
+
+// Include required verification algorithms
+
+#include "../../verification/simple/sadf_simple.h"
+#include "../../verification/simple/sadf_ergodic.h"
+#include "../../verification/boundedness/sadf_boundedness.h"
+
+// Include scheduler and type definitions
+
+#include "../schedulers/sadf_asap.h"
+#include "../schedulers/sadf_parallel_construction.h"
+
+// Function to analyse throughput of all processes (kernels followed by detectors) and average and variance
+// of buffer occupancy of all channels (data channels followed by control channels) from one TPS (returns number of stored states)
+
+CSize SADF_Analyse_LongRunMetrics(SADF_Graph* Graph, vector<CDouble>& Throughput, vector<CDouble>& AverageBufferOccupancy, vector<CDouble>& VarianceBufferOccupancy, const CDouble Tolerance = SADF_DEFAULT_TOLERANCE, const uint NumberOfThreads = 1);
+
+#endif
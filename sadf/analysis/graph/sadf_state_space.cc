@@ -35,17 +35,7 @@
 
 // Functions to analyse size of state space
 
-void SADF_ConstructTPS_ASAP(SADF_Graph* Graph, SADF_TPS* TPS, SADF_Configuration* Source) {
-
-	SADF_ListOfConfigurations NewConfigurations = SADF_ProgressTPS_ASAP(Graph, TPS, Source);
-	
-	while (!NewConfigurations.empty()) {
-		SADF_ConstructTPS_ASAP(Graph, TPS, NewConfigurations.front());
-		NewConfigurations.pop_front();
-	}
-}
-
-CSize SADF_Analyse_NumberOfStates(SADF_Graph* Graph) {
+CSize SADF_Analyse_NumberOfStates(SADF_Graph* Graph, const uint NumberOfThreads) {
 
 	// Check whether graph satisfied required properties
 
@@ -57,7 +47,7 @@ CSize SADF_Analyse_NumberOfStates(SADF_Graph* Graph) {
 	SADF_TPS* TPS = new SADF_TPS(Graph);
 	TPS->addConfiguration(TPS->getInitialConfiguration());
 	
-	SADF_ConstructTPS_ASAP(Graph, TPS, TPS->getInitialConfiguration());
+	SADF_ConstructTPS_Parallel(Graph, TPS, TPS->getInitialConfiguration(), SADF_ProgressTPS_ASAP, NumberOfThreads);
 
 	CSize NumberOfConfigurations = TPS->getNumberOfConfigurations();
 
@@ -66,17 +56,7 @@ CSize SADF_Analyse_NumberOfStates(SADF_Graph* Graph) {
 	return NumberOfConfigurations + 1;  // The additional one is the initial configuration entered without performing any action
 }
 
-void SADF_ConstructTPS_ASAP_Resolved(SADF_Graph* Graph, SADF_TPS* TPS, SADF_Configuration* Source) {
-
-	SADF_ListOfConfigurations NewConfigurations = SADF_ProgressTPS_ASAP_Resolved(Graph, TPS, Source);
-	
-	while (!NewConfigurations.empty()) {
-		SADF_ConstructTPS_ASAP_Resolved(Graph, TPS, NewConfigurations.front());
-		NewConfigurations.pop_front();
-	}
-}
-
-CSize SADF_Analyse_NumberOfStates_Resolved(SADF_Graph* Graph) {
+CSize SADF_Analyse_NumberOfStates_Resolved(SADF_Graph* Graph, const uint NumberOfThreads) {
 
 	// Check whether graph satisfied required properties
 
@@ -87,7 +67,7 @@ CSize SADF_Analyse_NumberOfStates_Resolved(SADF_Graph* Graph) {
 
 	SADF_TPS* TPS = new SADF_TPS(Graph);
 	TPS->addConfiguration(TPS->getInitialConfiguration());
-	SADF_ConstructTPS_ASAP_Resolved(Graph, TPS, TPS->getInitialConfiguration());
+	SADF_ConstructTPS_Parallel(Graph, TPS, TPS->getInitialConfiguration(), SADF_ProgressTPS_ASAP_Resolved, NumberOfThreads);
 
 	CSize NumberOfConfigurations = TPS->getNumberOfConfigurations();
 
@@ -41,10 +41,11 @@
 // Include scheduler and type definitions
 
 #include "../schedulers/sadf_asap.h"
+#include "../schedulers/sadf_parallel_construction.h"
 
 // Functions to analyse inter-firing latency (returns number of stored states)
 
-CSize SADF_Analyse_NumberOfStates(SADF_Graph* Graph);
-CSize SADF_Analyse_NumberOfStates_Resolved(SADF_Graph* Graph);
+CSize SADF_Analyse_NumberOfStates(SADF_Graph* Graph, const uint NumberOfThreads = 1);
+CSize SADF_Analyse_NumberOfStates_Resolved(SADF_Graph* Graph, const uint NumberOfThreads = 1);
 
 #endif
@@ -74,7 +74,7 @@ void SADF_ConstructTPS_PeriodicDeadlineMissProbability(SADF_Graph* Graph, SADF_T
 	}
 }
 
-CSize SADF_Analyse_PeriodicDeadlineMissProbability(SADF_Graph* Graph, CId ProcessType, CId ProcessID, CDouble& Deadline, CDouble& Result) {
+CSize SADF_Analyse_PeriodicDeadlineMissProbability(SADF_Graph* Graph, CId ProcessType, CId ProcessID, CDouble& Deadline, CDouble& Result, const CDouble Tolerance, const uint NumberOfThreads) {
 
 	// Check whether graph satisfied required properties
 
@@ -102,7 +102,7 @@ CSize SADF_Analyse_PeriodicDeadlineMissProbability(SADF_Graph* Graph, CId Proces
 
 	CSize NumberOfConfigurations = TPS->getNumberOfConfigurations();
 
-    vector<CDouble> EquilibriumDistribution = TPS->computeEquilibriumDistribution();
+    vector<CDouble> EquilibriumDistribution = TPS->computeEquilibriumDistribution(Tolerance, NumberOfThreads);
     
 	// Compute Results
 
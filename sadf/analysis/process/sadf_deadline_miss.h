@@ -46,7 +46,7 @@
 
 // Functions to analyse the deadline miss probability (returns number of stored states)
 
-CSize SADF_Analyse_PeriodicDeadlineMissProbability(SADF_Graph* Graph, CId ProcessType, CId ProcessID, CDouble& Deadline, CDouble& Result);
+CSize SADF_Analyse_PeriodicDeadlineMissProbability(SADF_Graph* Graph, CId ProcessType, CId ProcessID, CDouble& Deadline, CDouble& Result, const CDouble Tolerance = SADF_DEFAULT_TOLERANCE, const uint NumberOfThreads = 1);
 CSize SADF_Analyse_ResponseDeadlineMissProbability(SADF_Graph* Graph, CId ProcessType, CId ProcessID, CDouble& Deadline, CDouble& Result);
 
 #endif
@@ -97,7 +97,7 @@ void SADF_ConstructTPS_InterFiringLatency(SADF_Graph* Graph, SADF_TPS* TPS, SADF
 
 // Function to analyse inter-firing latency
 
-CSize SADF_Analyse_LongRunInterFiringLatency(SADF_Graph* Graph, CId ProcessType, CId ProcessID, CDouble& Average, CDouble& Variance) {
+CSize SADF_Analyse_LongRunInterFiringLatency(SADF_Graph* Graph, CId ProcessType, CId ProcessID, CDouble& Average, CDouble& Variance, const CDouble Tolerance, const uint NumberOfThreads) {
 
 	// Check whether graph satisfied required properties
 
@@ -126,7 +126,7 @@ CSize SADF_Analyse_LongRunInterFiringLatency(SADF_Graph* Graph, CId ProcessType,
 
 	CSize NumberOfConfigurations = TPS->getNumberOfConfigurations();
 
-    vector<CDouble> EquilibriumDistribution = TPS->computeEquilibriumDistribution();
+    vector<CDouble> EquilibriumDistribution = TPS->computeEquilibriumDistribution(Tolerance, NumberOfThreads);
 
 	// Compute Results
 
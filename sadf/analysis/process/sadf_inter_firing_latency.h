@@ -46,7 +46,7 @@
 
 // Functions to analyse inter-firing latency (returns number of stored states)
 
-CSize SADF_Analyse_LongRunInterFiringLatency(SADF_Graph* Graph, CId ProcessType, CId ProcessID, CDouble& Average, CDouble& Variance);
+CSize SADF_Analyse_LongRunInterFiringLatency(SADF_Graph* Graph, CId ProcessType, CId ProcessID, CDouble& Average, CDouble& Variance, const CDouble Tolerance = SADF_DEFAULT_TOLERANCE, const uint NumberOfThreads = 1);
 CSize SADF_Analyse_ExtreemInterFiringLatency(SADF_Graph* Graph, CId ProcessType, CId ProcessID, CDouble& Minimum, CDouble& Maximum);
 
 #endif
@@ -141,9 +141,11 @@ SADF_ListOfConfigurations SADF_ProgressTPS_ASAP(SADF_Graph* Graph, SADF_TPS* TPS
 	return NewConfigurations;
 }
 
-SADF_ListOfConfigurations SADF_ProgressTPS_ASAP_Resolved(SADF_Graph* Graph, SADF_TPS* TPS, SADF_Configuration* Source) {
+SADF_ListOfConfigurations SADF_ProgressTPS_ASAP_Resolved(SADF_Graph* Graph, SADF_TPS* TPS, SADF_Configuration* Source, SADF_Process*& Actor, const bool RelevantStep) {
 
 	SADF_ListOfConfigurations NewConfigurations;
+
+	Actor = NULL;
 	
 	bool ActionPossible = false;
 	
@@ -153,7 +155,8 @@ SADF_ListOfConfigurations SADF_ProgressTPS_ASAP_Resolved(SADF_Graph* Graph, SADF
 		if (Graph->getKernel(i)->hasControlChannels())
 			if (Source->getKernelStatus(i)->isReadyToFire()) {
 				ActionPossible = true;
-				NewConfigurations = Source->getKernelStatus(i)->control(Graph, TPS, true);
+				Actor = Graph->getKernel(i);
+				NewConfigurations = Source->getKernelStatus(i)->control(Graph, TPS, RelevantStep);
 			}
 	
 	// Perform a detect action
@@ -161,7 +164,8 @@ SADF_ListOfConfigurations SADF_ProgressTPS_ASAP_Resolved(SADF_Graph* Graph, SADF
 	for (CId i = 0; !ActionPossible && i != Graph->getNumberOfDetectors(); i++)
 		if (Source->getDetectorStatus(i)->isReadyToFire()) {
 			ActionPossible = true;
-			NewConfigurations = Source->getDetectorStatus(i)->detect(Graph, TPS, true);
+			Actor = Graph->getDetector(i);
+			NewConfigurations = Source->getDetectorStatus(i)->detect(Graph, TPS, RelevantStep);
 		}		
 	
 	// Perform a start action
@@ -169,13 +173,15 @@ SADF_ListOfConfigurations SADF_ProgressTPS_ASAP_Resolved(SADF_Graph* Graph, SADF
 	for (CId i = 0; !ActionPossible && i != Graph->getNumberOfKernels(); i++)
 		if (Source->getKernelStatus(i)->isReadyToStart()) {
 			ActionPossible = true;
-			NewConfigurations = Source->getKernelStatus(i)->start(Graph, TPS, true);
+			Actor = Graph->getKernel(i);
+			NewConfigurations = Source->getKernelStatus(i)->start(Graph, TPS, RelevantStep);
 		}
 	
 	for (CId i = 0; !ActionPossible && i != Graph->getNumberOfDetectors(); i++)
 		if (Source->getDetectorStatus(i)->isReadyToStart()) {
 			ActionPossible = true;
-			NewConfigurations = Source->getDetectorStatus(i)->start(Graph, TPS, true);
+			Actor = Graph->getDetector(i);
+			NewConfigurations = Source->getDetectorStatus(i)->start(Graph, TPS, RelevantStep);
 		}
 
 	// Perform an end action
@@ -183,13 +189,15 @@ SADF_ListOfConfigurations SADF_ProgressTPS_ASAP_Resolved(SADF_Graph* Graph, SADF
 	for (CId i = 0; !ActionPossible && i != Graph->getNumberOfKernels(); i++)
 		if (Source->getKernelStatus(i)->isReadyToEnd()) {
 			ActionPossible = true;
-			NewConfigurations = Source->getKernelStatus(i)->end(Graph, TPS, true);
+			Actor = Graph->getKernel(i);
+			NewConfigurations = Source->getKernelStatus(i)->end(Graph, TPS, RelevantStep);
 		}
 		
 	for (CId i = 0; !ActionPossible && i != Graph->getNumberOfDetectors(); i++)
 		if (Source->getDetectorStatus(i)->isReadyToEnd()) {
 			ActionPossible = true;
-			NewConfigurations = Source->getDetectorStatus(i)->end(Graph, TPS, true);
+			Actor = Graph->getDetector(i);
+			NewConfigurations = Source->getDetectorStatus(i)->end(Graph, TPS, RelevantStep);
 		}
 
 	// Check whether a time step should be performed istead of an action
@@ -199,7 +207,7 @@ SADF_ListOfConfigurations SADF_ProgressTPS_ASAP_Resolved(SADF_Graph* Graph, SADF
 		if (Source->getType() == SADF_TIME_STEP || Source->getMinimalRemainingExecutionTime() == SADF_MAX_DOUBLE)
 			throw CException((CString)("Error: SADF graph '") + Graph->getName() + "' has a deadlock.");
 
-		SADF_Configuration* NewConfiguration = Source->time(Graph, TPS, true);
+		SADF_Configuration* NewConfiguration = Source->time(Graph, TPS, RelevantStep);
 			
 		if (NewConfiguration != NULL)
 			NewConfigurations.push_front(NewConfiguration);
@@ -207,3 +215,10 @@ SADF_ListOfConfigurations SADF_ProgressTPS_ASAP_Resolved(SADF_Graph* Graph, SADF
 
 	return NewConfigurations;
 }
+
+SADF_ListOfConfigurations SADF_ProgressTPS_ASAP_Resolved(SADF_Graph* Graph, SADF_TPS* TPS, SADF_Configuration* Source) {
+
+	SADF_Process* Actor;
+
+	return SADF_ProgressTPS_ASAP_Resolved(Graph, TPS, Source, Actor);
+}
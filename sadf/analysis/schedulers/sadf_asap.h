@@ -42,5 +42,6 @@
 
 SADF_ListOfConfigurations SADF_ProgressTPS_ASAP(SADF_Graph* Graph, SADF_TPS* TPS, SADF_Configuration* Source);
 SADF_ListOfConfigurations SADF_ProgressTPS_ASAP_Resolved(SADF_Graph* Graph, SADF_TPS* TPS, SADF_Configuration* Source);
+SADF_ListOfConfigurations SADF_ProgressTPS_ASAP_Resolved(SADF_Graph* Graph, SADF_TPS* TPS, SADF_Configuration* Source, SADF_Process*& Actor, const bool RelevantStep = true);	// Actor is NULL for time steps
 
 #endif
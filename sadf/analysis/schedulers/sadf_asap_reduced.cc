@@ -537,8 +537,6 @@ SADF_ListOfConfigurations SADF_ProgressTPS_ASAP_BufferSize(SADF_Graph* Graph, SA
 
 	// Check existance of relevant configuration
 	
-	RelevantConfiguration->computeHashKey();
-	
 	SADF_Configuration* Test = TPS->inConfigurationSpace(RelevantConfiguration);
 				
 	if (Test != NULL)
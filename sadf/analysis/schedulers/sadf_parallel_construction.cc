@@ -0,0 +1,105 @@
+/*
+ *  Eindhoven University of Technology
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   sadf_parallel_construction.cc
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   17 October 2026
+ *
+ *  Function        :   Level-synchronous parallel construction of TPS
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ * 
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+
+#include "sadf_parallel_construction.h"
+
+// Administration of the construction of a single level of the TPS
+
+typedef struct _SADF_ParallelConstruction {
+
+	SADF_Graph* Graph;
+	SADF_TPS* TPS;
+	SADF_ProgressFunction Progress;
+	vector<SADF_Configuration*>* Frontier;
+
+} SADF_ParallelConstruction;
+
+static void SADF_ProgressFrontierBlock(void* Arg, const CSize Block, const uint Thread) {
+
+	SADF_ParallelConstruction* C = (SADF_ParallelConstruction*)Arg;
+
+	CSize First = Block * SADF_CONFIGURATIONS_PER_JOB;
+	CSize Last = First + SADF_CONFIGURATIONS_PER_JOB;
+
+	if (Last > C->Frontier->size())
+		Last = C->Frontier->size();
+
+	// New configurations are found again from the transitions of the frontier
+
+	for (CSize i = First; i != Last; i++)
+		C->Progress(C->Graph, C->TPS, (*C->Frontier)[i]);
+}
+
+void SADF_ConstructTPS_Parallel(SADF_Graph* Graph, SADF_TPS* TPS, SADF_Configuration* Source, SADF_ProgressFunction Progress, const uint NumberOfThreads) {
+
+	vector<SADF_Configuration*> Frontier(1, Source);
+
+	SADF_ParallelConstruction Construction;
+	Construction.Graph = Graph;
+	Construction.TPS = TPS;
+	Construction.Progress = Progress;
+	Construction.Frontier = &Frontier;
+
+	TPS->beginConcurrentConstruction();
+
+	try {
+
+		while (!Frontier.empty()) {
+
+			// Progress all configurations in the frontier
+
+			CSize NumberOfBlocks = (Frontier.size() + SADF_CONFIGURATIONS_PER_JOB - 1) / SADF_CONFIGURATIONS_PER_JOB;
+
+			runParallelJobs(SADF_ProgressFrontierBlock, &Construction, NumberOfBlocks, NumberOfThreads);
+
+			// Add new configurations to the configuration space in the order of the frontier and its transitions
+
+			vector<SADF_Configuration*> NextFrontier;
+
+			for (CSize i = 0; i != Frontier.size(); i++)
+				for (list<SADF_Transition*>::iterator j = Frontier[i]->getTransitions().begin(); j != Frontier[i]->getTransitions().end(); j++)
+					if ((*j)->getDestination()->getIdentity() == SADF_UNDEFINED) {
+						TPS->addConfiguration((*j)->getDestination());
+						NextFrontier.push_back((*j)->getDestination());
+					}
+
+			TPS->clearPendingConfigurations();
+
+			Frontier.swap(NextFrontier);
+		}
+
+	} catch (CException&) {
+		TPS->endConcurrentConstruction();
+		throw;
+	}
+
+	TPS->endConcurrentConstruction();
+}
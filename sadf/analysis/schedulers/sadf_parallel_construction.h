@@ -0,0 +1,48 @@
+/*
+ *  Eindhoven University of Technology
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   sadf_parallel_construction.h
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   17 October 2026
+ *
+ *  Function        :   Level-synchronous parallel construction of TPS
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ * 
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+
+#ifndef SADF_PARALLEL_CONSTRUCTION_H_INCLUDED
+#define SADF_PARALLEL_CONSTRUCTION_H_INCLUDED
+
+// Include type definitions
+
+#include "../../base/tps/sadf_tps.h"
+
+// Function to progress the TPS from a single configuration (see sadf_asap.h)
+
+typedef SADF_ListOfConfigurations (*SADF_ProgressFunction)(SADF_Graph* Graph, SADF_TPS* TPS, SADF_Configuration* Source);
+
+// Function to construct the TPS reachable from Source. All configurations at the same distance from Source are
+// progressed concurrently. Identities are assigned in order of discovery, which does not depend on NumberOfThreads.
+
+void SADF_ConstructTPS_Parallel(SADF_Graph* Graph, SADF_TPS* TPS, SADF_Configuration* Source, SADF_ProgressFunction Progress, const uint NumberOfThreads);
+
+#endif
@@ -63,4 +63,21 @@
 #define SADF_CONTROL_STEP 3
 #define SADF_DETECT_STEP 4
 
+// Constants as macros - equilibrium distributions (TPS)
+
+#define SADF_DIRECT_SOLVER_LIMIT	2000		// Largest Markov chain solved by Gaussian elimination
+#define SADF_DEFAULT_TOLERANCE		1e-12		// Convergence bound of iterative solver
+#define SADF_MAXIMUM_ITERATIONS		1000000
+#define SADF_EQUILIBRIUM_BLOCK_SIZE	1024		// Number of configurations in a block of iterative solver
+
+// Constants as macros - concurrent construction (TPS)
+
+#define SADF_PENDING_INDEX_SHARDS	64		// Number of independently locked parts of index of pending configurations
+#define SADF_CONFIGURATIONS_PER_JOB	64		// Number of configurations expanded by a single job
+
+// Constants as macros - simulation
+
+#define SADF_DEFAULT_REPLICATIONS	10		// Number of independent replications of a simulation
+#define SADF_DEFAULT_CONFIDENCE		0.95		// Confidence level of estimated performance metrics
+
 #endif
@@ -130,26 +130,27 @@ bool SADF_MarkovChain::isDeterministicCycle() {
 
 vector<CDouble> SADF_MarkovChain::computeEquilibriumDistribution() {
 
-	// Initialise augmented matrix
+	// Assemble augmented matrix
 
-    SparseMatrix* Matrix = new SparseMatrix(StateSpace.size());
+	SparseMatrixBuilder Builder(StateSpace.size(), StateSpace.size() + 1);
 
     for (CId i = 0; i != StateSpace.size(); i++)
         for (CId j = 0; j != StateSpace.size() - 1; j++)
             if (TransitionMatrix[i][j] > 0)
-                Matrix->set(j, i, TransitionMatrix[i][j]);
+                Builder.add(j, i, TransitionMatrix[i][j]);
 
 	for (CId i = 0; i != StateSpace.size() + 1; i++) {
 		
-		Matrix->set(StateSpace.size() - 1, i, 1);
+		Builder.add(StateSpace.size() - 1, i, 1);
 		
 		if (i < StateSpace.size() - 1)
-			Matrix->set(i, i, Matrix->get(i, i) - 1);
+			Builder.add(i, i, -1);
 	}
 
-    vector<CDouble> EquilibriumDistribution = Matrix->computeEigenVector();
+	CompressedSparseMatrix Compressed(Builder);
+	SparseMatrix Matrix(Compressed);
 
-    delete Matrix;
+    vector<CDouble> EquilibriumDistribution = Matrix.computeEigenVector();
 
     return EquilibriumDistribution;
 }
@@ -32,16 +32,23 @@
  */
 
 #include "sadf_channel_status.h"
+#include "sadf_configuration.h"
 
 // Constructors
 
-SADF_ChannelStatus::SADF_ChannelStatus(SADF_Channel* C) {
+SADF_ChannelStatus::SADF_ChannelStatus(SADF_Configuration* Conf, SADF_Channel* C) {
+
+	Configuration = Conf;
+	Channel = C;
 
 	ReservedLocations = 0;
 	AvailableTokens = C->getNumberOfInitialTokens();
 }
 
-SADF_ChannelStatus::SADF_ChannelStatus(SADF_ChannelStatus* S) {
+SADF_ChannelStatus::SADF_ChannelStatus(SADF_Configuration* Conf, SADF_ChannelStatus* S) {
+
+	Configuration = Conf;
+	Channel = S->getChannel();
 
 	ReservedLocations = S->getReservedLocations();
 	AvailableTokens = S->getAvailableTokens();
@@ -56,13 +63,30 @@ void SADF_ChannelStatus::reserve(const CId NumberOfTokens) {
 
 void SADF_ChannelStatus::write(const CId NumberOfTokens) {
 
+	SADF_HashKey OldKey = getHashKey();
+
 	ReservedLocations -= NumberOfTokens;
 	AvailableTokens += NumberOfTokens;
+
+	Configuration->updateHashKey(OldKey, getHashKey());
 }
 
 void SADF_ChannelStatus::remove(const CId NumberOfTokens) {
 
+	SADF_HashKey OldKey = getHashKey();
+
 	AvailableTokens -= NumberOfTokens;
+
+	Configuration->updateHashKey(OldKey, getHashKey());
+}
+
+// Contribution to hash key of configuration
+
+SADF_HashKey SADF_ChannelStatus::getHashKey() const {
+
+	// Reserved locations follow from the status of the writing process
+
+	return SADF_FinalHashKey(SADF_AddToHashKey(SADF_InitialHashKey(SADF_HASH_DATA_CHANNEL, Channel->getIdentity()), (SADF_HashKey)AvailableTokens));
 }
 
 // Equality operator
@@ -37,6 +37,11 @@
 // Include type definitions
 
 #include "../sadf/sadf_graph.h"
+#include "sadf_hash_key.h"
+
+// Forward declarations
+
+class SADF_Configuration;
 
 // SADF_ChannelStatus Definition
 
@@ -45,8 +50,8 @@ class SADF_ChannelStatus {
 public:
 	// Constructor
 
-	SADF_ChannelStatus(SADF_Channel* C);
-	SADF_ChannelStatus(SADF_ChannelStatus* S);
+	SADF_ChannelStatus(SADF_Configuration* Conf, SADF_Channel* C);
+	SADF_ChannelStatus(SADF_Configuration* Conf, SADF_ChannelStatus* S);
 	
 	// Destructor
 
@@ -54,6 +59,7 @@ public:
 
 	// Access to current status
 
+	SADF_Channel* getChannel() const { return Channel; };
 	CId getAvailableTokens() const { return AvailableTokens; };
 	CId getReservedLocations() const { return ReservedLocations; };
 	CId getOccupation() const { return ReservedLocations + AvailableTokens; };
@@ -64,6 +70,10 @@ public:
 	void write(const CId NumberOfTokens);
 	void remove(const CId NumberOfTokens);
 
+	// Contribution to hash key of configuration
+
+	SADF_HashKey getHashKey() const;
+
 	// Equality operator
 	
 	bool equal(const SADF_ChannelStatus* S);
@@ -71,6 +81,9 @@ public:
 private:
 	// instance variables
 
+	SADF_Configuration* Configuration;
+	SADF_Channel* Channel;
+
 	CId AvailableTokens;
 	CId ReservedLocations;
 };
@@ -35,27 +35,33 @@
 #include "sadf_tps.h"
 #include "sadf_kernel_status.h"
 #include "sadf_detector_status.h"
+#include <new>
+
+// Hash key of step type
+
+static SADF_HashKey SADF_StepTypeHashKey(const CId StepType) {
+
+	return SADF_FinalHashKey(SADF_InitialHashKey(SADF_HASH_STEP_TYPE, StepType));
+}
 
 // Constructors
 
 SADF_Configuration::SADF_Configuration(SADF_Graph* Graph, SADF_TPS* TPS, CId StepType) : SADF_Component(SADF_UNDEFINED) {
 
-	KernelStatus.resize(Graph->getNumberOfKernels());
-	DetectorStatus.resize(Graph->getNumberOfDetectors());
-	ChannelStatus.resize(Graph->getNumberOfDataChannels());
-	ControlStatus.resize(Graph->getNumberOfControlChannels());
+	Pool = TPS->getStatusPool();
+	allocateStatus(Graph);
 
-	for (CId i = 0; i != Graph->getNumberOfKernels(); i++)
-		KernelStatus[i] = new SADF_KernelStatus(this, TPS->getInitialKernelState(i), SADF_MAX_DOUBLE);
+	for (CId i = 0; i != NumberOfKernels; i++)
+		new (getKernelStatus(i)) SADF_KernelStatus(this, TPS->getInitialKernelState(i), SADF_MAX_DOUBLE);
 	
-	for (CId i = 0; i != Graph->getNumberOfDetectors(); i++)
-		DetectorStatus[i] = new SADF_DetectorStatus(this, TPS->getInitialDetectorState(i), SADF_MAX_DOUBLE);
+	for (CId i = 0; i != NumberOfDetectors; i++)
+		new (getDetectorStatus(i)) SADF_DetectorStatus(this, TPS->getInitialDetectorState(i), SADF_MAX_DOUBLE);
 		
-	for (CId i = 0; i != Graph->getNumberOfDataChannels(); i++)
-		ChannelStatus[i] = new SADF_ChannelStatus(Graph->getDataChannel(i));
+	for (CId i = 0; i != NumberOfDataChannels; i++)
+		new (getChannelStatus(i)) SADF_ChannelStatus(this, Graph->getDataChannel(i));
 		
-	for (CId i = 0; i != Graph->getNumberOfControlChannels(); i++)
-		ControlStatus[i] = new SADF_ControlStatus(Graph->getControlChannel(i));
+	for (CId i = 0; i != NumberOfControlChannels; i++)
+		new (getControlStatus(i)) SADF_ControlStatus(this, TPS, Graph->getControlChannel(i));
 
 	MinimalRemainingExecutionTime = SADF_MAX_DOUBLE;
 
@@ -69,28 +75,30 @@ SADF_Configuration::SADF_Configuration(SADF_Graph* Graph, SADF_TPS* TPS, CId Ste
 
 SADF_Configuration::SADF_Configuration(SADF_Graph* Graph, SADF_Configuration* C, CId StepType, CDouble Value) : SADF_Component(SADF_UNDEFINED) {
 	
-	KernelStatus.resize(Graph->getNumberOfKernels());
-	DetectorStatus.resize(Graph->getNumberOfDetectors());
-	ChannelStatus.resize(Graph->getNumberOfDataChannels());
-	ControlStatus.resize(Graph->getNumberOfControlChannels());
+	Pool = C->getStatusPool();
+	allocateStatus(Graph);
 
-	for (CId i = 0; i != Graph->getNumberOfKernels(); i++)
-		KernelStatus[i] = new SADF_KernelStatus(this, C->getKernelStatus(i));
+	for (CId i = 0; i != NumberOfKernels; i++)
+		new (getKernelStatus(i)) SADF_KernelStatus(this, C->getKernelStatus(i));
 
-	for (CId i = 0; i != Graph->getNumberOfDetectors(); i++)
-		DetectorStatus[i] = new SADF_DetectorStatus(this, C->getDetectorStatus(i));
+	for (CId i = 0; i != NumberOfDetectors; i++)
+		new (getDetectorStatus(i)) SADF_DetectorStatus(this, C->getDetectorStatus(i));
 
-	for (CId i = 0; i != Graph->getNumberOfDataChannels(); i++)
- 		ChannelStatus[i] = new SADF_ChannelStatus(C->getChannelStatus(i));
+	for (CId i = 0; i != NumberOfDataChannels; i++)
+ 		new (getChannelStatus(i)) SADF_ChannelStatus(this, C->getChannelStatus(i));
 	
-	for (CId i = 0; i != Graph->getNumberOfControlChannels(); i++)
-		ControlStatus[i] = new SADF_ControlStatus(C->getControlStatus(i));
+	for (CId i = 0; i != NumberOfControlChannels; i++)
+		new (getControlStatus(i)) SADF_ControlStatus(this, C->getControlStatus(i));
 
 	MinimalRemainingExecutionTime = C->getMinimalRemainingExecutionTime();
 
 	setType(StepType);
 	StepValue = Value;
 
+	// The status of all processes and channels is copied, only the step type differs
+
+	HashKey = C->getHashKey() ^ SADF_StepTypeHashKey(C->getType()) ^ SADF_StepTypeHashKey(StepType);
+
 	Relevant = false;
 	Marking = false;
 }
@@ -99,72 +107,75 @@ SADF_Configuration::SADF_Configuration(SADF_Graph* Graph, SADF_Configuration* C,
 
 SADF_Configuration::~SADF_Configuration() {
 
-	for (CId i = 0; i != KernelStatus.size(); i++)
-		delete KernelStatus[i];
-	
-	for (CId i = 0; i != DetectorStatus.size(); i++)
-		delete DetectorStatus[i];
-	
-	for (CId i = 0; i != ChannelStatus.size(); i++)
-		delete ChannelStatus[i];
-	
-	for (CId i = 0; i != ControlStatus.size(); i++)
-		delete ControlStatus[i];
-	
+	deleteContent();
+
 	for (list<SADF_Transition*>::iterator i = Transitions.begin(); i != Transitions.end(); i++)
 		delete *i;
 }
 
 void SADF_Configuration::deleteContent() {
 
-	for (CId i = 0; i != KernelStatus.size(); i++)
-		delete KernelStatus[i];
-	
-	for (CId i = 0; i != DetectorStatus.size(); i++)
-		delete DetectorStatus[i];
+	for (CId i = 0; i != NumberOfKernels; i++)
+		getKernelStatus(i)->~SADF_KernelStatus();
 	
-	for (CId i = 0; i != ChannelStatus.size(); i++)
-		delete ChannelStatus[i];
+	for (CId i = 0; i != NumberOfDetectors; i++)
+		getDetectorStatus(i)->~SADF_DetectorStatus();
 	
-	for (CId i = 0; i != ControlStatus.size(); i++)
-		delete ControlStatus[i];
+	for (CId i = 0; i != NumberOfDataChannels; i++)
+		getChannelStatus(i)->~SADF_ChannelStatus();
 	
-	KernelStatus.resize(0);
-	DetectorStatus.resize(0);
-	ChannelStatus.resize(0);
-	ControlStatus.resize(0);
+	for (CId i = 0; i != NumberOfControlChannels; i++)
+		getControlStatus(i)->~SADF_ControlStatus();
+
+	if (Pool != NULL)
+		Pool->release(Status);
+	else
+		delete[] Status;
+
+	Status = NULL;
+	NumberOfKernels = 0;
+	NumberOfDetectors = 0;
+	NumberOfDataChannels = 0;
+	NumberOfControlChannels = 0;
+}
+
+CSize SADF_Configuration::getStatusSize(SADF_Graph* Graph) {
+
+	// All types of status are aligned as pointers, so they can be stored one after another
+
+	return Graph->getNumberOfKernels() * sizeof(SADF_KernelStatus) + Graph->getNumberOfDetectors() * sizeof(SADF_DetectorStatus) + Graph->getNumberOfDataChannels() * sizeof(SADF_ChannelStatus) + Graph->getNumberOfControlChannels() * sizeof(SADF_ControlStatus);
+}
+
+void SADF_Configuration::allocateStatus(SADF_Graph* Graph) {
+
+	NumberOfKernels = Graph->getNumberOfKernels();
+	NumberOfDetectors = Graph->getNumberOfDetectors();
+	NumberOfDataChannels = Graph->getNumberOfDataChannels();
+	NumberOfControlChannels = Graph->getNumberOfControlChannels();
+
+	if (Pool != NULL)
+		Status = Pool->allocate();
+	else
+		Status = new char[getStatusSize(Graph)];
 }
 
 // Computation of hash key
 
 void SADF_Configuration::computeHashKey() {
 
-	HashKey = getType() * 0.6180339887;
+	HashKey = SADF_StepTypeHashKey(getType());
 	
-	for (CId i = 0; i != KernelStatus.size(); i++) {
-		HashKey = HashKey * 39164205.20662217 + KernelStatus[i]->getState()->getScenario() * 0.6180339887;
-		
-		if (KernelStatus[i]->getRemainingExecutionTime() != SADF_MAX_DOUBLE)
-			HashKey = HashKey * 39164205.20662217 + KernelStatus[i]->getRemainingExecutionTime() * 0.6180339887;
-	}
+	for (CId i = 0; i != NumberOfKernels; i++)
+		HashKey ^= getKernelStatus(i)->getHashKey();
 
-	for (CId i = 0; i != DetectorStatus.size(); i++) {
-		HashKey = HashKey * 39164205.20662217 + DetectorStatus[i]->getState()->getScenario() * 0.6180339887;
-
-		if (DetectorStatus[i]->getRemainingExecutionTime() != SADF_MAX_DOUBLE)
-			HashKey = HashKey * 39164205.20662217 + DetectorStatus[i]->getRemainingExecutionTime() * 0.6180339887;
-		
-		for (CId j = 0; j != DetectorStatus[i]->getState()->getMarkovChainStatus().size(); j++)
-			HashKey = HashKey * 39164205.20662217 + DetectorStatus[i]->getState()->getStateOfMarkovChain(j) * 0.6180339887;
-	}
+	for (CId i = 0; i != NumberOfDetectors; i++)
+		HashKey ^= getDetectorStatus(i)->getHashKey();
 	
-	for (CId i = 0; i != ChannelStatus.size(); i++) {
-		HashKey = HashKey * 39164205.20662217 + ChannelStatus[i]->getAvailableTokens() * 0.6180339887;
-	}
+	for (CId i = 0; i != NumberOfDataChannels; i++)
+		HashKey ^= getChannelStatus(i)->getHashKey();
 
-	for (CId i = 0; i != ControlStatus.size(); i++) {
-		HashKey = HashKey * 39164205.20662217 + ControlStatus[i]->getAvailableTokens() * 0.6180339887;
-	}
+	for (CId i = 0; i != NumberOfControlChannels; i++)
+		HashKey ^= getControlStatus(i)->getHashKey();
 }
 
 // Functions to access transitions
@@ -229,7 +240,7 @@ SADF_Configuration* SADF_Configuration::time(SADF_Graph* Graph, SADF_TPS* TPS, b
 	NewConfiguration->setMinimalRemainingExecutionTime(SADF_MAX_DOUBLE);
 		
 	for (CId i = 0; i != Graph->getNumberOfKernels(); i++)
-		if (KernelStatus[i]->getState()->getType() == SADF_START_STEP) {
+		if (getKernelStatus(i)->getState()->getType() == SADF_START_STEP) {
 			
 			CDouble RemainingExecutionTime = NewConfiguration->getKernelStatus(i)->getRemainingExecutionTime() - MinimalRemainingExecutionTime;
 
@@ -242,7 +253,7 @@ SADF_Configuration* SADF_Configuration::time(SADF_Graph* Graph, SADF_TPS* TPS, b
 		}
 
 	for (CId i = 0; i != Graph->getNumberOfDetectors(); i++)
-		if (DetectorStatus[i]->getState()->getType() == SADF_START_STEP) {
+		if (getDetectorStatus(i)->getState()->getType() == SADF_START_STEP) {
 			
 			CDouble RemainingExecutionTime = NewConfiguration->getDetectorStatus(i)->getRemainingExecutionTime() - MinimalRemainingExecutionTime;
 				
@@ -256,17 +267,16 @@ SADF_Configuration* SADF_Configuration::time(SADF_Graph* Graph, SADF_TPS* TPS, b
 
 	if (RelevantStep) {
 	
-		NewConfiguration->computeHashKey();
-		SADF_Configuration* Test = TPS->inConfigurationSpace(NewConfiguration);
+		NewConfiguration->setRelevance(true);
+
+		SADF_Configuration* Test = TPS->findOrAddConfiguration(NewConfiguration);
 				
 		if (Test != NULL) {
 			addTransition(Test, 1, 0);
 			delete NewConfiguration;
 			return NULL;
 		} else {
-			NewConfiguration->setRelevance(true);
 			addTransition(NewConfiguration, 1, 0);
-			TPS->addConfiguration(NewConfiguration);
 			return NewConfiguration;
 		}
 	
@@ -283,17 +293,17 @@ bool SADF_Configuration::equal(SADF_Configuration* C) {
 
 	bool Equal = getType() == C->getType() && MinimalRemainingExecutionTime == C->getMinimalRemainingExecutionTime();
 
-	for (CId i = 0; Equal && i != DetectorStatus.size(); i++)
-		Equal = DetectorStatus[i]->equal(C->getDetectorStatus(i));
+	for (CId i = 0; Equal && i != NumberOfDetectors; i++)
+		Equal = getDetectorStatus(i)->equal(C->getDetectorStatus(i));
 	
-	for (CId i = 0; Equal && i != ControlStatus.size(); i++)
-		Equal = ControlStatus[i]->equal(C->getControlStatus(i));
+	for (CId i = 0; Equal && i != NumberOfControlChannels; i++)
+		Equal = getControlStatus(i)->equal(C->getControlStatus(i));
 
-	for (CId i = 0; Equal && i != KernelStatus.size(); i++)
-		Equal = KernelStatus[i]->equal(C->getKernelStatus(i));
+	for (CId i = 0; Equal && i != NumberOfKernels; i++)
+		Equal = getKernelStatus(i)->equal(C->getKernelStatus(i));
 		
-	for (CId i = 0; Equal && i != ChannelStatus.size(); i++)
-		Equal = ChannelStatus[i]->equal(C->getChannelStatus(i));
+	for (CId i = 0; Equal && i != NumberOfDataChannels; i++)
+		Equal = getChannelStatus(i)->equal(C->getChannelStatus(i));
 	
 	return Equal;
 }
@@ -311,33 +321,33 @@ void SADF_Configuration::print(ostream& out) {
 	
 	out << "Minimal Remaining Execution Time: " << MinimalRemainingExecutionTime << endl << endl;
 	
-	for (CId i = 0; i != KernelStatus.size(); i++) {
+	for (CId i = 0; i != NumberOfKernels; i++) {
 		out << "*** Kernel " << i << " ***" << endl;
-		out << " State Type: " << KernelStatus[i]->getState()->getType() << endl;
-		out << " Execution Time: " << KernelStatus[i]->getState()->getExecutionTime() << endl;
-		out << " Scenario: " << KernelStatus[i]->getState()->getScenario() << endl;
-		out << " RemainingExecutionTime: " << KernelStatus[i]->getRemainingExecutionTime() << endl << endl;
+		out << " State Type: " << getKernelStatus(i)->getState()->getType() << endl;
+		out << " Execution Time: " << getKernelStatus(i)->getState()->getExecutionTime() << endl;
+		out << " Scenario: " << getKernelStatus(i)->getState()->getScenario() << endl;
+		out << " RemainingExecutionTime: " << getKernelStatus(i)->getRemainingExecutionTime() << endl << endl;
 	}
 
-	for (CId i = 0; i != DetectorStatus.size(); i++) {
+	for (CId i = 0; i != NumberOfDetectors; i++) {
 		out << "*** Detector " << i << " ***" << endl;
-		out << " State Type: " << DetectorStatus[i]->getState()->getType() << endl;
-		out << " Execution Time: " << DetectorStatus[i]->getState()->getExecutionTime() << endl;
-		out << " Scenario: " << DetectorStatus[i]->getState()->getScenario() << endl;
-		out << " SubScenario: " << DetectorStatus[i]->getState()->getSubScenario() << endl;
-		out << " RemainingExecutionTime: " << DetectorStatus[i]->getRemainingExecutionTime() << endl << endl;
+		out << " State Type: " << getDetectorStatus(i)->getState()->getType() << endl;
+		out << " Execution Time: " << getDetectorStatus(i)->getState()->getExecutionTime() << endl;
+		out << " Scenario: " << getDetectorStatus(i)->getState()->getScenario() << endl;
+		out << " SubScenario: " << getDetectorStatus(i)->getState()->getSubScenario() << endl;
+		out << " RemainingExecutionTime: " << getDetectorStatus(i)->getRemainingExecutionTime() << endl << endl;
 	}
 	
-	for (CId i = 0; i != ChannelStatus.size(); i++) {
+	for (CId i = 0; i != NumberOfDataChannels; i++) {
 		out << "*** Data Channel " << i << " ***" << endl;
-		out << " Number of Available Tokens: " << ChannelStatus[i]->getAvailableTokens() << endl;
-		out << " Reserved Locations: " << ChannelStatus[i]->getReservedLocations() << endl << endl;
+		out << " Number of Available Tokens: " << getChannelStatus(i)->getAvailableTokens() << endl;
+		out << " Reserved Locations: " << getChannelStatus(i)->getReservedLocations() << endl << endl;
 	}
 	
-	for (CId i = 0; i != ControlStatus.size(); i++) {
+	for (CId i = 0; i != NumberOfControlChannels; i++) {
 		out << "*** Control Channel " << i << " ***" << endl;
-		out << " Number of Available Tokens: " << ControlStatus[i]->getAvailableTokens() << endl;
-		out << " Reserved Locations: " << ControlStatus[i]->getReservedLocations() << endl << endl;
+		out << " Number of Available Tokens: " << getControlStatus(i)->getAvailableTokens() << endl;
+		out << " Reserved Locations: " << getControlStatus(i)->getReservedLocations() << endl << endl;
 	}
 	
 	for (list<SADF_Transition*>::iterator i = Transitions.begin(); i != Transitions.end(); i++)
@@ -37,15 +37,17 @@
 // Include type definitions
 
 #include "../sadf/sadf_graph.h"
+#include "sadf_hash_key.h"
 #include "sadf_channel_status.h"
 #include "sadf_control_status.h"
 #include "sadf_transition.h"
+#include "sadf_kernel_status.h"
+#include "sadf_detector_status.h"
+#include "sadf_status_pool.h"
 
 // Forward declarations
 
 class SADF_TPS;
-class SADF_KernelStatus;
-class SADF_DetectorStatus;
 
 // SADF_Configuration Definition
 
@@ -64,17 +66,21 @@ public:
 	// Hash key and Step Value
 	
 	void computeHashKey();
-	CDouble getHashKey() const { return HashKey; };
+	SADF_HashKey getHashKey() const { return HashKey; };
+	void updateHashKey(const SADF_HashKey OldStatusKey, const SADF_HashKey NewStatusKey) { HashKey ^= OldStatusKey ^ NewStatusKey; };
 
 	// Access to current status
 	
-	SADF_KernelStatus* getKernelStatus(const CId KernelID) const { return KernelStatus[KernelID]; };
-	SADF_DetectorStatus* getDetectorStatus(const CId DetectorID) const { return DetectorStatus[DetectorID]; };
-	SADF_ChannelStatus* getChannelStatus(const CId DataChannelID) const { return ChannelStatus[DataChannelID]; };
-	SADF_ControlStatus* getControlStatus(const CId ControlChannelID) { return ControlStatus[ControlChannelID]; };
+	SADF_KernelStatus* getKernelStatus(const CId KernelID) const { return (SADF_KernelStatus*)Status + KernelID; };
+	SADF_DetectorStatus* getDetectorStatus(const CId DetectorID) const { return (SADF_DetectorStatus*)(getKernelStatus(NumberOfKernels)) + DetectorID; };
+	SADF_ChannelStatus* getChannelStatus(const CId DataChannelID) const { return (SADF_ChannelStatus*)(getDetectorStatus(NumberOfDetectors)) + DataChannelID; };
+	SADF_ControlStatus* getControlStatus(const CId ControlChannelID) const { return (SADF_ControlStatus*)(getChannelStatus(NumberOfDataChannels)) + ControlChannelID; };
 
 	void deleteContent();
 
+	static CSize getStatusSize(SADF_Graph* Graph);
+	SADF_StatusPool* getStatusPool() const { return Pool; };
+
 	// Transitions - common functions for all configuration types
 
 	list<SADF_Transition*>& getTransitions() { return Transitions; };
@@ -125,14 +131,21 @@ public:
 private:
 	// Instance Variables
 
-	CDouble HashKey;
+	SADF_HashKey HashKey;
 	CDouble StepValue;
 	CDouble MinimalRemainingExecutionTime;
 
-	vector<SADF_KernelStatus*> KernelStatus;
-	vector<SADF_DetectorStatus*> DetectorStatus;
-	vector<SADF_ChannelStatus*> ChannelStatus;
-	vector<SADF_ControlStatus*> ControlStatus;
+	// Status of all kernels, detectors, data channels and control channels in a single block
+	// (local states of processes and contents of control channels are interned by the TPS)
+
+	void allocateStatus(SADF_Graph* Graph);
+
+	char* Status;
+	SADF_StatusPool* Pool;		// NULL if status is allocated on the heap
+	CId NumberOfKernels;
+	CId NumberOfDetectors;
+	CId NumberOfDataChannels;
+	CId NumberOfControlChannels;
 
 	list<SADF_Transition*> Transitions;
 	
@@ -142,9 +155,4 @@ private:
 	vector<CDouble> LocalResults;
 };
 
-// Type definitions
-
-typedef list<SADF_Configuration*> SADF_ListOfConfigurations;
-typedef list<SADF_ListOfConfigurations> SADF_HashedListOfConfigurations;
-
 #endif
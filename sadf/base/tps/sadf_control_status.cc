@@ -32,25 +32,52 @@
  */
 
 #include "sadf_control_status.h"
+#include "sadf_configuration.h"
+#include "sadf_tps.h"
 
 // Constructors
 
-SADF_ControlStatus::SADF_ControlStatus(SADF_Channel* C) { 
+SADF_ControlContent::SADF_ControlContent(const CQueue& Numbers, const CQueue& Content) {
+
+	NumbersQueue = Numbers;
+	ContentQueue = Content;
+
+	// Key over all scenarios and numbers of tokens in the queue
+
+	HashKey = SADF_InitialHashKey(SADF_HASH_CONTROL_CHANNEL, ContentQueue.size());
+
+	CQueue N = NumbersQueue;
+	CQueue C = ContentQueue;
+
+	while (!C.empty()) {
+		HashKey = SADF_AddToHashKey(SADF_AddToHashKey(HashKey, (SADF_HashKey)C.front()), (SADF_HashKey)N.front());
+		C.pop();
+		N.pop();
+	}
+
+	HashKey = SADF_FinalHashKey(HashKey);
+}
+
+SADF_ControlStatus::SADF_ControlStatus(SADF_Configuration* Conf, SADF_TPS* TPS, SADF_Channel* C) { 
+
+	Configuration = Conf;
+	Channel = C;
 
 	ReservedLocations = 0;
 	AvailableTokens = C->getNumberOfInitialTokens();
 	
-	NumbersQueue = C->getNumbersQueue();
-	ContentQueue = C->getContentQueue();
+	Content = TPS->internControlContent(C->getNumbersQueue(), C->getContentQueue());
 }
 
-SADF_ControlStatus::SADF_ControlStatus(SADF_ControlStatus* S) {
+SADF_ControlStatus::SADF_ControlStatus(SADF_Configuration* Conf, SADF_ControlStatus* S) {
 	
+	Configuration = Conf;
+	Channel = S->getChannel();
+
 	ReservedLocations = S->getReservedLocations();
 	AvailableTokens = S->getAvailableTokens();
 
-	NumbersQueue = S->getNumbersQueue();
-	ContentQueue = S->getContentQueue();
+	Content = S->getContent();
 }
 
 // Functions to change status
@@ -60,11 +87,16 @@ void SADF_ControlStatus::reserve(const CId NumberOfTokens) {
 	ReservedLocations += NumberOfTokens;
 }
 
-void SADF_ControlStatus::write(const CId NumberOfTokens, const CId ScenarioID) {
+void SADF_ControlStatus::write(SADF_TPS* TPS, const CId NumberOfTokens, const CId ScenarioID) {
+
+	SADF_HashKey OldKey = getHashKey();
 
 	ReservedLocations -= NumberOfTokens;
 	AvailableTokens += NumberOfTokens;
 	
+	CQueue NumbersQueue = Content->getNumbersQueue();
+	CQueue ContentQueue = Content->getContentQueue();
+
 	if (!ContentQueue.empty()) {
 		if (ContentQueue.back() == ScenarioID)
 			NumbersQueue.back() += NumberOfTokens;
@@ -76,30 +108,56 @@ void SADF_ControlStatus::write(const CId NumberOfTokens, const CId ScenarioID) {
 		NumbersQueue.push(NumberOfTokens);
 		ContentQueue.push(ScenarioID);
 	}
+
+	Content = TPS->internControlContent(NumbersQueue, ContentQueue);
+
+	Configuration->updateHashKey(OldKey, getHashKey());
 }
 
 CId SADF_ControlStatus::inspect() {
 
-	return ContentQueue.front();
+	return Content->getContentQueue().front();
 }
 
-void SADF_ControlStatus::remove() {
+void SADF_ControlStatus::remove(SADF_TPS* TPS) {
+
+	SADF_HashKey OldKey = getHashKey();
 
 	AvailableTokens--;
+
+	CQueue NumbersQueue = Content->getNumbersQueue();
+	CQueue ContentQueue = Content->getContentQueue();
+
 	NumbersQueue.front()--;
 
 	if (NumbersQueue.front() == 0) {
 		NumbersQueue.pop();
 		ContentQueue.pop();
 	}
+
+	Content = TPS->internControlContent(NumbersQueue, ContentQueue);
+
+	Configuration->updateHashKey(OldKey, getHashKey());
+}
+
+// Contribution to hash key of configuration
+
+SADF_HashKey SADF_ControlStatus::getHashKey() const {
+
+	SADF_HashKey Key = SADF_InitialHashKey(SADF_HASH_CONTROL_CHANNEL, Channel->getIdentity());
+
+	Key = SADF_AddToHashKey(Key, (SADF_HashKey)AvailableTokens);
+	Key = SADF_AddToHashKey(Key, Content->getHashKey());
+
+	return SADF_FinalHashKey(Key);
 }
 
 // Equality operator
 
 bool SADF_ControlStatus::equal(SADF_ControlStatus* S) {
 
-	return AvailableTokens == S->getAvailableTokens() && NumbersQueue == S->getNumbersQueue() && ContentQueue == S->getContentQueue();
+	return AvailableTokens == S->getAvailableTokens() && Content == S->getContent();
 
-	// Checking equality of available tokens is to speed up the check
+	// Contents are interned, so equal contents are the same object
 	// Equality of reserved locations follows from equality of status of writing process
 }
@@ -37,6 +37,43 @@
 // Include type definitions
 
 #include "../sadf/sadf_graph.h"
+#include "sadf_hash_key.h"
+
+// Forward declarations
+
+class SADF_Configuration;
+class SADF_TPS;
+
+// SADF_ControlContent Definition (contents of a control channel, shared by all configurations in a TPS with equal contents)
+
+class SADF_ControlContent {
+
+public:
+	// Constructor
+
+	SADF_ControlContent(const CQueue& Numbers, const CQueue& Content);
+
+	// Destructor
+
+	~SADF_ControlContent() { };
+
+	// Access to instance variables
+
+	const CQueue& getContentQueue() const { return ContentQueue; };
+	const CQueue& getNumbersQueue() const { return NumbersQueue; };
+	SADF_HashKey getHashKey() const { return HashKey; };
+
+	// Equality operator
+
+	bool equal(const SADF_ControlContent* C) const { return NumbersQueue == C->getNumbersQueue() && ContentQueue == C->getContentQueue(); };
+
+private:
+	// Instance Variables
+
+	CQueue ContentQueue;
+	CQueue NumbersQueue;
+	SADF_HashKey HashKey;
+};
 
 // SADF_ControlStatus Definition
 
@@ -45,8 +82,8 @@ class SADF_ControlStatus {
 public:
 	// Contructor
 	
-	SADF_ControlStatus(SADF_Channel* C);
-	SADF_ControlStatus(SADF_ControlStatus* S);
+	SADF_ControlStatus(SADF_Configuration* Conf, SADF_TPS* TPS, SADF_Channel* C);
+	SADF_ControlStatus(SADF_Configuration* Conf, SADF_ControlStatus* S);
 
 	// Destructor
 
@@ -54,33 +91,37 @@ public:
 
 	// Access to current status
 
+	SADF_Channel* getChannel() const { return Channel; };
 	CId getAvailableTokens() const { return AvailableTokens; };
 	CId getReservedLocations() const { return ReservedLocations; };
 	CId getOccupation() const { return AvailableTokens + ReservedLocations; };
-
-	CQueue& getContentQueue() { return ContentQueue; };
-	CQueue& getNumbersQueue() { return NumbersQueue; };
+	SADF_ControlContent* getContent() const { return Content; };
+	const CQueue& getContentQueue() const { return Content->getContentQueue(); };
+	const CQueue& getNumbersQueue() const { return Content->getNumbersQueue(); };
 
 	// Functions to change status
-
+	
 	void reserve(const CId NumberOfTokens);
-	void write(const CId NumberOfTokens, const CId ScenarioID);
+	void write(SADF_TPS* TPS, const CId NumberOfTokens, const CId ScenarioID);
 	CId inspect();
-	void remove();
+	void remove(SADF_TPS* TPS);
+
+	// Contribution to hash key of configuration
+
+	SADF_HashKey getHashKey() const;
 
 	// Equality operator
-	
+
 	bool equal(SADF_ControlStatus* S);
 
 protected:
 	// instance variables
 
+	SADF_Configuration* Configuration;
+	SADF_Channel* Channel;
 	CId AvailableTokens;
 	CId ReservedLocations;
-	
-	CQueue ContentQueue;
-	CQueue NumbersQueue;
-
+	SADF_ControlContent* Content;		// Interned by TPS
 };
 
 #endif
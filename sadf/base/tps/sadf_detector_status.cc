@@ -84,6 +84,39 @@ void SADF_DetectorState::addTransition(SADF_DetectorState* D, CDouble P) {
 	Transitions.push_front(new SADF_DetectorTransition(D, P));
 }
 
+// Access to instance variables of status
+
+void SADF_DetectorStatus::setState(SADF_DetectorState* S) {
+
+	SADF_HashKey OldKey = getHashKey();
+
+	State = S;
+	RemainingExecutionTime = State->getExecutionTime();
+
+	Configuration->updateHashKey(OldKey, getHashKey());
+}
+
+void SADF_DetectorStatus::setRemainingExecutionTime(CDouble T) {
+
+	SADF_HashKey OldKey = getHashKey();
+
+	RemainingExecutionTime = T;
+
+	Configuration->updateHashKey(OldKey, getHashKey());
+}
+
+// Contribution to hash key of configuration
+
+SADF_HashKey SADF_DetectorStatus::getHashKey() const {
+
+	SADF_HashKey Key = SADF_InitialHashKey(SADF_HASH_DETECTOR, State->getDetector()->getIdentity());
+
+	Key = SADF_AddToHashKey(Key, (SADF_HashKey)State->getIdentity());
+	Key = SADF_AddToHashKey(Key, RemainingExecutionTime);
+
+	return SADF_FinalHashKey(Key);
+}
+
 // Functions to determine current status
 
 bool SADF_DetectorStatus::isReadyToFire() {
@@ -177,16 +210,15 @@ SADF_ListOfConfigurations SADF_DetectorStatus::detect(SADF_Graph* Graph, SADF_TP
 
 			if (RelevantStep) {
 
-				NewConfiguration->computeHashKey();
-				SADF_Configuration* Test = TPS->inConfigurationSpace(NewConfiguration);
+				NewConfiguration->setRelevance(true);
+
+				SADF_Configuration* Test = TPS->findOrAddConfiguration(NewConfiguration);
 				
 				if (Test != NULL) {
 					Configuration->addTransition(Test, (*i)->getProbability(), 0);
 					delete NewConfiguration;
 				} else {
-					NewConfiguration->setRelevance(true);
 					Configuration->addTransition(NewConfiguration, (*i)->getProbability(), 0);
-					TPS->addConfiguration(NewConfiguration);
 					NewConfigurations.push_front(NewConfiguration);
 				}
 
@@ -229,16 +261,15 @@ SADF_ListOfConfigurations SADF_DetectorStatus::start(SADF_Graph* Graph, SADF_TPS
 
 		if (RelevantStep) {
 
-			NewConfiguration->computeHashKey();
-			SADF_Configuration* Test = TPS->inConfigurationSpace(NewConfiguration);
+			NewConfiguration->setRelevance(true);
+
+			SADF_Configuration* Test = TPS->findOrAddConfiguration(NewConfiguration);
 				
 			if (Test != NULL) {
 				Configuration->addTransition(Test, (*i)->getProbability(), 0);
 				delete NewConfiguration;
 			} else {
-				NewConfiguration->setRelevance(true);
 				Configuration->addTransition(NewConfiguration, (*i)->getProbability(), 0);
-				TPS->addConfiguration(NewConfiguration);
 				NewConfigurations.push_front(NewConfiguration);
 			}
 
@@ -263,7 +294,7 @@ SADF_ListOfConfigurations SADF_DetectorStatus::end(SADF_Graph* Graph, SADF_TPS*
 	SADF_Process* Detector = State->getDetector();
 
 	for (list<SADF_Channel*>::iterator i = Detector->getControlChannels().begin(); i != Detector->getControlChannels().end(); i++)
-		NewConfiguration->getControlStatus((*i)->getIdentity())->remove();
+		NewConfiguration->getControlStatus((*i)->getIdentity())->remove(TPS);
 				
 	for (list<SADF_Channel*>::iterator i = Detector->getInputChannels().begin(); i != Detector->getInputChannels().end(); i++)
 		NewConfiguration->getChannelStatus((*i)->getIdentity())->remove(Detector->getConsumptionRate((*i)->getIdentity(), State->getSubScenario()));
@@ -272,7 +303,7 @@ SADF_ListOfConfigurations SADF_DetectorStatus::end(SADF_Graph* Graph, SADF_TPS*
 		if ((*i)->getType() == SADF_DATA_CHANNEL)
 			NewConfiguration->getChannelStatus((*i)->getIdentity())->write(Detector->getProductionRate((*i)->getIdentity(), SADF_DATA_CHANNEL, State->getSubScenario()));
 		else
-			NewConfiguration->getControlStatus((*i)->getIdentity())->write(Detector->getProductionRate((*i)->getIdentity(), SADF_CONTROL_CHANNEL, State->getSubScenario()), Detector->getSubScenario(State->getSubScenario())->getScenarioIdentityProducedToChannel((*i)->getIdentity()));
+			NewConfiguration->getControlStatus((*i)->getIdentity())->write(TPS, Detector->getProductionRate((*i)->getIdentity(), SADF_CONTROL_CHANNEL, State->getSubScenario()), Detector->getSubScenario(State->getSubScenario())->getScenarioIdentityProducedToChannel((*i)->getIdentity()));
 
 	NewConfiguration->getDetectorStatus(Detector->getIdentity())->setState(State->getTransitions().front()->getDestination());
 	
@@ -280,16 +311,15 @@ SADF_ListOfConfigurations SADF_DetectorStatus::end(SADF_Graph* Graph, SADF_TPS*
 	
 	if (RelevantStep) {
 	
-		NewConfiguration->computeHashKey();
-		SADF_Configuration* Test = TPS->inConfigurationSpace(NewConfiguration);
+		NewConfiguration->setRelevance(true);
+
+		SADF_Configuration* Test = TPS->findOrAddConfiguration(NewConfiguration);
 		
 		if (Test != NULL) {
 			Configuration->addTransition(Test, 1, 0);
 			delete NewConfiguration;
 		} else {
-			NewConfiguration->setRelevance(true);
 			Configuration->addTransition(NewConfiguration, 1, 0);
-			TPS->addConfiguration(NewConfiguration);
 			NewConfigurations.push_front(NewConfiguration);
 		}
 		
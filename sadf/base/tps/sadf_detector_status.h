@@ -37,10 +37,12 @@
 // Include type definitions
 
 #include "../sadf/sadf_graph.h"
-#include "sadf_configuration.h"
+#include "sadf_hash_key.h"
+#include "sadf_transition.h"
 
 // Forward Declarations
 
+class SADF_TPS;
 class SADF_DetectorState;
 
 // SADF_DetectorTransition Definition
@@ -127,11 +129,15 @@ public:
 	
 	SADF_Configuration* getConfiguration() const { return Configuration; };
 	
-	void setState(SADF_DetectorState* S) { State = S; RemainingExecutionTime = State->getExecutionTime(); };
+	void setState(SADF_DetectorState* S);
 	SADF_DetectorState* getState() const { return State; };
-	void setRemainingExecutionTime(CDouble T) { RemainingExecutionTime = T; };
+	void setRemainingExecutionTime(CDouble T);
 	CDouble getRemainingExecutionTime() const { return RemainingExecutionTime; };
 
+	// Contribution to hash key of configuration
+
+	SADF_HashKey getHashKey() const;
+
 	// Functions to determine current status
 	
 	bool isReadyToFire();
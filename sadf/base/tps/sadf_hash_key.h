@@ -0,0 +1,89 @@
+/*
+ *  Eindhoven University of Technology
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   sadf_hash_key.h
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   17 October 2026
+ *
+ *  Function        :   SADF Hash Keys of Configurations
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+#ifndef SADF_HASH_KEY_H_INCLUDED
+#define SADF_HASH_KEY_H_INCLUDED
+
+// Include type definitions
+
+#include "../sadf/sadf_defines.h"
+
+// The hash key of a configuration is the exclusive or of the keys of the status of all its
+// processes and channels and the key of its step type. A change in the status of a process
+// or channel therefore updates the key of the configuration without visiting other statuses.
+
+typedef unsigned long long SADF_HashKey;
+
+// Kinds of status which contribute to a key
+
+#define SADF_HASH_STEP_TYPE		0
+#define SADF_HASH_KERNEL		1
+#define SADF_HASH_DETECTOR		2
+#define SADF_HASH_DATA_CHANNEL		3
+#define SADF_HASH_CONTROL_CHANNEL	4
+
+// Functions to compute keys (FNV-1a over the packed words of a status)
+
+inline SADF_HashKey SADF_AddToHashKey(SADF_HashKey Key, const SADF_HashKey Value) {
+
+	return (Key ^ Value) * 1099511628211ULL;
+}
+
+inline SADF_HashKey SADF_AddToHashKey(SADF_HashKey Key, const CDouble Value) {
+
+	// Equal times must give equal keys (0 and -0 compare equal)
+
+	SADF_HashKey Bits = 0;
+
+	if (Value != 0)
+		memcpy(&Bits, &Value, sizeof(CDouble));
+
+	return SADF_AddToHashKey(Key, Bits);
+}
+
+inline SADF_HashKey SADF_InitialHashKey(const CId Kind, const CId ID) {
+
+	return SADF_AddToHashKey(SADF_AddToHashKey(14695981039346656037ULL, (SADF_HashKey)Kind), (SADF_HashKey)ID);
+}
+
+inline SADF_HashKey SADF_FinalHashKey(SADF_HashKey Key) {
+
+	// Spread the entropy over all bits, so that keys can be combined with exclusive or
+
+	Key ^= Key >> 33;
+	Key *= 0xff51afd7ed558ccdULL;
+	Key ^= Key >> 33;
+	Key *= 0xc4ceb9fe1a85ec53ULL;
+	Key ^= Key >> 33;
+
+	return Key;
+}
+
+#endif
@@ -82,6 +82,39 @@ void SADF_KernelState::addTransition(SADF_KernelState* K, CDouble P) {
 	Transitions.push_front(new SADF_KernelTransition(K, P));
 }
 
+// Access to instance variables of status
+
+void SADF_KernelStatus::setState(SADF_KernelState* S) {
+
+	SADF_HashKey OldKey = getHashKey();
+
+	State = S;
+	RemainingExecutionTime = State->getExecutionTime();
+
+	Configuration->updateHashKey(OldKey, getHashKey());
+}
+
+void SADF_KernelStatus::setRemainingExecutionTime(CDouble T) {
+
+	SADF_HashKey OldKey = getHashKey();
+
+	RemainingExecutionTime = T;
+
+	Configuration->updateHashKey(OldKey, getHashKey());
+}
+
+// Contribution to hash key of configuration
+
+SADF_HashKey SADF_KernelStatus::getHashKey() const {
+
+	SADF_HashKey Key = SADF_InitialHashKey(SADF_HASH_KERNEL, State->getKernel()->getIdentity());
+
+	Key = SADF_AddToHashKey(Key, (SADF_HashKey)State->getIdentity());
+	Key = SADF_AddToHashKey(Key, RemainingExecutionTime);
+
+	return SADF_FinalHashKey(Key);
+}
+
 // Functions to determine current status
 
 bool SADF_KernelStatus::isReadyToFire() {
@@ -169,16 +202,15 @@ SADF_ListOfConfigurations SADF_KernelStatus::control(SADF_Graph* Graph, SADF_TPS
 	
 	if (RelevantStep) {
 	
-		NewConfiguration->computeHashKey();
-		SADF_Configuration* Test = TPS->inConfigurationSpace(NewConfiguration);
+		NewConfiguration->setRelevance(true);
+
+		SADF_Configuration* Test = TPS->findOrAddConfiguration(NewConfiguration);
 				
 		if (Test != NULL) {
 			Configuration->addTransition(Test, 1, 0);
 			delete NewConfiguration;
 		} else {
-			NewConfiguration->setRelevance(true);
 			Configuration->addTransition(NewConfiguration, 1, 0);
-			TPS->addConfiguration(NewConfiguration);
 			NewConfigurations.push_front(NewConfiguration);
 		}
 	
@@ -222,16 +254,15 @@ SADF_ListOfConfigurations SADF_KernelStatus::start(SADF_Graph* Graph, SADF_TPS*
 
 		if (RelevantStep) {
 
-			NewConfiguration->computeHashKey();
-			SADF_Configuration* Test = TPS->inConfigurationSpace(NewConfiguration);
+			NewConfiguration->setRelevance(true);
+
+			SADF_Configuration* Test = TPS->findOrAddConfiguration(NewConfiguration);
 				
 			if (Test != NULL) {
 				Configuration->addTransition(Test, (*i)->getProbability(), 0);
 				delete NewConfiguration;
 			} else {
-				NewConfiguration->setRelevance(true);
 				Configuration->addTransition(NewConfiguration, (*i)->getProbability(), 0);
-				TPS->addConfiguration(NewConfiguration);
 				NewConfigurations.push_front(NewConfiguration);
 			}
 
@@ -256,7 +287,7 @@ SADF_ListOfConfigurations SADF_KernelStatus::end(SADF_Graph* Graph, SADF_TPS* TP
 	SADF_Process* Kernel = State->getKernel();
 
 	for (list<SADF_Channel*>::iterator i = Kernel->getControlChannels().begin(); i != Kernel->getControlChannels().end(); i++)
-		NewConfiguration->getControlStatus((*i)->getIdentity())->remove();
+		NewConfiguration->getControlStatus((*i)->getIdentity())->remove(TPS);
 	
 	if (Kernel->isActive(State->getScenario())) {
 	
@@ -273,16 +304,15 @@ SADF_ListOfConfigurations SADF_KernelStatus::end(SADF_Graph* Graph, SADF_TPS* TP
 	
 	if (RelevantStep) {
 	
-		NewConfiguration->computeHashKey();
-		SADF_Configuration* Test = TPS->inConfigurationSpace(NewConfiguration);
+		NewConfiguration->setRelevance(true);
+
+		SADF_Configuration* Test = TPS->findOrAddConfiguration(NewConfiguration);
 		
 		if (Test != NULL) {
 			Configuration->addTransition(Test, 1, 0);
 			delete NewConfiguration;
 		} else {
-			NewConfiguration->setRelevance(true);
 			Configuration->addTransition(NewConfiguration, 1, 0);
-			TPS->addConfiguration(NewConfiguration);
 			NewConfigurations.push_front(NewConfiguration);
 		}
 		
@@ -37,10 +37,12 @@
 // Include type definitions
 
 #include "../sadf/sadf_graph.h"
-#include "sadf_configuration.h"
+#include "sadf_hash_key.h"
+#include "sadf_transition.h"
 
 // Forward Declarations
 
+class SADF_TPS;
 class SADF_KernelState;
 
 // SADF_KernelTransition Definition
@@ -122,11 +124,15 @@ public:
 	
 	SADF_Configuration* getConfiguration() const { return Configuration; };
 	
-	void setState(SADF_KernelState* S) { State = S; RemainingExecutionTime = State->getExecutionTime(); };
+	void setState(SADF_KernelState* S);
 	SADF_KernelState* getState() const { return State; };
-	void setRemainingExecutionTime(CDouble T) { RemainingExecutionTime = T; };
+	void setRemainingExecutionTime(CDouble T);
 	CDouble getRemainingExecutionTime() const { return RemainingExecutionTime; };
 
+	// Contribution to hash key of configuration
+
+	SADF_HashKey getHashKey() const;
+
 	// Functions to determine current status
 	
 	bool isReadyToFire();
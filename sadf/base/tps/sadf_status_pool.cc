@@ -0,0 +1,73 @@
+/*
+ *  Eindhoven University of Technology
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   sadf_status_pool.cc
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   17 October 2026
+ *
+ *  Function        :   SADF Pool of Status Blocks of Configurations
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+
+#include "sadf_status_pool.h"
+
+// Constructor
+
+SADF_StatusPool::SADF_StatusPool(const CSize BlockSize) : Size(BlockSize) {
+
+	pthread_mutex_init(&Lock, NULL);
+}
+
+// Destructor
+
+SADF_StatusPool::~SADF_StatusPool() {
+
+	pthread_mutex_destroy(&Lock);
+}
+
+// Allocation of blocks
+
+char* SADF_StatusPool::allocate() {
+
+	char* Block;
+
+	pthread_mutex_lock(&Lock);
+
+	if (FreeBlocks.empty())
+		Block = (char*)Arena.alloc(Size);
+	else {
+		Block = FreeBlocks.back();
+		FreeBlocks.pop_back();
+	}
+
+	pthread_mutex_unlock(&Lock);
+
+	return Block;
+}
+
+void SADF_StatusPool::release(char* Block) {
+
+	pthread_mutex_lock(&Lock);
+	FreeBlocks.push_back(Block);
+	pthread_mutex_unlock(&Lock);
+}
@@ -0,0 +1,67 @@
+/*
+ *  Eindhoven University of Technology
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   sadf_status_pool.h
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   17 October 2026
+ *
+ *  Function        :   SADF Pool of Status Blocks of Configurations
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+
+#ifndef SADF_STATUS_POOL_H_INCLUDED
+#define SADF_STATUS_POOL_H_INCLUDED
+
+// Include type definitions
+
+#include "../sadf/sadf_defines.h"
+#include <pthread.h>
+
+// SADF_StatusPool Definition (all blocks are equally sized and placed in an arena, which is spilled to disk if a spill directory is set)
+
+class SADF_StatusPool {
+
+public:
+	// Constructor
+
+	SADF_StatusPool(const CSize BlockSize);
+
+	// Destructor
+
+	~SADF_StatusPool();
+
+	// Allocation of blocks (safe to use during concurrent construction)
+
+	char* allocate();
+	void release(char* Block);
+
+private:
+	// Instance Variables
+
+	CSize Size;
+	CArena Arena;
+	vector<char*> FreeBlocks;
+	pthread_mutex_t Lock;
+};
+
+#endif
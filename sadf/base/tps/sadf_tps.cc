@@ -32,6 +32,23 @@
  */
 
 #include "sadf_tps.h"
+#include <pthread.h>
+
+// Part of the index of pending configurations, guarded by its own lock
+
+struct SADF_PendingConfigurations {
+
+	pthread_mutex_t Lock;
+	std::tr1::unordered_map<SADF_HashKey, SADF_ListOfConfigurations> Index;
+};
+
+// Interned contents of control channels, guarded by a lock
+
+struct SADF_ControlContents {
+
+	pthread_mutex_t Lock;
+	std::tr1::unordered_map<SADF_HashKey, list<SADF_ControlContent*> > Index;
+};
 
 // Functions for constructing detector states
 
@@ -150,6 +167,17 @@ void SADF_ConstructDetectorStates(SADF_Graph* Graph, SADF_TPS* TPS, CId Detector
 SADF_TPS::SADF_TPS(SADF_Graph* Graph) {
 
 	NumberOfConfigurations = 0;
+	NumberOfRecurrentComponents = 0;
+
+	ControlContents = new SADF_ControlContents();
+	pthread_mutex_init(&ControlContents->Lock, NULL);
+
+	// Status of configurations is kept in temporary files if a spill directory is set
+
+	if (CArena::getSpillDirectory().empty())
+		StatusPool = NULL;
+	else
+		StatusPool = new SADF_StatusPool(SADF_Configuration::getStatusSize(Graph));
 	
 	KernelStates.resize(Graph->getNumberOfKernels());
 	DetectorStates.resize(Graph->getNumberOfDetectors());
@@ -198,6 +226,8 @@ SADF_TPS::SADF_TPS(SADF_Graph* Graph) {
 
 SADF_TPS::~SADF_TPS() {
 
+	endConcurrentConstruction();
+
 	for (CId i = 0; i != KernelStates.size(); i++)
 		for (list<SADF_KernelState*>::iterator j = KernelStates[i].begin(); j != KernelStates[i].end(); j++)
 			delete (*j);
@@ -209,6 +239,16 @@ SADF_TPS::~SADF_TPS() {
 	for (SADF_HashedListOfConfigurations::iterator i = ConfigurationSpace.begin(); i != ConfigurationSpace.end(); i++)
 		for (SADF_ListOfConfigurations::iterator j = (*i).begin(); j != (*i).end(); j++)
 			delete *j;
+
+	for (std::tr1::unordered_map<SADF_HashKey, list<SADF_ControlContent*> >::iterator i = ControlContents->Index.begin(); i != ControlContents->Index.end(); i++)
+		for (list<SADF_ControlContent*>::iterator j = i->second.begin(); j != i->second.end(); j++)
+			delete *j;
+
+	pthread_mutex_destroy(&ControlContents->Lock);
+	delete ControlContents;
+
+	if (StatusPool != NULL)
+		delete StatusPool;
 }
 
 // Access to instance variables
@@ -217,18 +257,15 @@ void SADF_TPS::addConfiguration(SADF_Configuration* C) {
 
 	C->setIdentity(NumberOfConfigurations);
 	
-	bool MatchFound = false;
-	
-	for (SADF_HashedListOfConfigurations::iterator i = ConfigurationSpace.begin(); !MatchFound && i != ConfigurationSpace.end(); i++)
-		if ((*i).front()->getHashKey() == C->getHashKey()) {
-			(*i).push_front(C);
-			MatchFound = true;
-		}
+	SADF_ConfigurationIndex::iterator Match = ConfigurationIndex.find(C->getHashKey());
 	
-	if (!MatchFound) {
+	if (Match != ConfigurationIndex.end())
+		(*Match->second).push_front(C);
+	else {
 		SADF_ListOfConfigurations NewListOfConfigurations;
 		NewListOfConfigurations.push_front(C);
 		ConfigurationSpace.push_front(NewListOfConfigurations);	
+		ConfigurationIndex[C->getHashKey()] = ConfigurationSpace.begin();
 	}
 	
 	NumberOfConfigurations++;
@@ -236,15 +273,103 @@ void SADF_TPS::addConfiguration(SADF_Configuration* C) {
 
 SADF_Configuration* SADF_TPS::inConfigurationSpace(SADF_Configuration* C) {
 
-	for (SADF_HashedListOfConfigurations::iterator i = ConfigurationSpace.begin(); i != ConfigurationSpace.end(); i++)
-		if ((*i).front()->getHashKey() == C->getHashKey())
-			for (SADF_ListOfConfigurations::iterator j = (*i).begin(); j != (*i).end(); j++)
-				if ((*j)->equal(C))
-					return *j;
+	SADF_ConfigurationIndex::iterator Match = ConfigurationIndex.find(C->getHashKey());
+
+	if (Match != ConfigurationIndex.end())
+		for (SADF_ListOfConfigurations::iterator j = (*Match->second).begin(); j != (*Match->second).end(); j++)
+			if ((*j)->equal(C))
+				return *j;
 
 	return NULL;
 }
 
+SADF_ControlContent* SADF_TPS::internControlContent(const CQueue& Numbers, const CQueue& Content) {
+
+	SADF_ControlContent C(Numbers, Content);
+	SADF_ControlContent* Match = NULL;
+
+	pthread_mutex_lock(&ControlContents->Lock);
+
+	list<SADF_ControlContent*>& Candidates = ControlContents->Index[C.getHashKey()];
+
+	for (list<SADF_ControlContent*>::iterator i = Candidates.begin(); Match == NULL && i != Candidates.end(); i++)
+		if ((*i)->equal(&C))
+			Match = *i;
+
+	if (Match == NULL) {
+		Match = new SADF_ControlContent(C);
+		Candidates.push_front(Match);
+	}
+
+	pthread_mutex_unlock(&ControlContents->Lock);
+
+	return Match;
+}
+
+SADF_Configuration* SADF_TPS::findOrAddConfiguration(SADF_Configuration* C) {
+
+	// The configuration space itself is only read during concurrent construction
+
+	SADF_Configuration* Match = inConfigurationSpace(C);
+
+	if (Match != NULL)
+		return Match;
+
+	if (!isConcurrentConstruction()) {
+		addConfiguration(C);
+		return NULL;
+	}
+
+	SADF_PendingConfigurations* Shard = PendingConfigurations[C->getHashKey() % PendingConfigurations.size()];
+
+	pthread_mutex_lock(&Shard->Lock);
+
+	SADF_ListOfConfigurations& Candidates = Shard->Index[C->getHashKey()];
+
+	for (SADF_ListOfConfigurations::iterator i = Candidates.begin(); Match == NULL && i != Candidates.end(); i++)
+		if ((*i)->equal(C))
+			Match = *i;
+
+	if (Match == NULL)
+		Candidates.push_front(C);
+
+	pthread_mutex_unlock(&Shard->Lock);
+
+	return Match;
+}
+
+void SADF_TPS::beginConcurrentConstruction() {
+
+	PendingConfigurations.resize(SADF_PENDING_INDEX_SHARDS);
+
+	for (CId i = 0; i != PendingConfigurations.size(); i++) {
+		PendingConfigurations[i] = new SADF_PendingConfigurations();
+		pthread_mutex_init(&PendingConfigurations[i]->Lock, NULL);
+	}
+}
+
+void SADF_TPS::clearPendingConfigurations() {
+
+	for (CId i = 0; i != PendingConfigurations.size(); i++)
+		PendingConfigurations[i]->Index.clear();
+}
+
+void SADF_TPS::endConcurrentConstruction() {
+
+	for (CId i = 0; i != PendingConfigurations.size(); i++) {
+
+		for (std::tr1::unordered_map<SADF_HashKey, SADF_ListOfConfigurations>::iterator j = PendingConfigurations[i]->Index.begin(); j != PendingConfigurations[i]->Index.end(); j++)
+			for (SADF_ListOfConfigurations::iterator k = j->second.begin(); k != j->second.end(); k++)
+				if ((*k)->getIdentity() == SADF_UNDEFINED)
+					delete *k;
+
+		pthread_mutex_destroy(&PendingConfigurations[i]->Lock);
+		delete PendingConfigurations[i];
+	}
+
+	PendingConfigurations.clear();
+}
+
 void SADF_TPS::deleteContentOfConfigurations() {
 
 	for (SADF_HashedListOfConfigurations::iterator i = ConfigurationSpace.begin(); i != ConfigurationSpace.end(); i++)
@@ -253,80 +378,141 @@ void SADF_TPS::deleteContentOfConfigurations() {
 }
 
 
-// Functions to determine graph properties
+// Functions to remove transient configurations
+
+// Configuration on the depth-first path of Tarjan's algorithm with its next transition to explore
+
+typedef struct _SADF_TarjanFrame {
+
+	SADF_Configuration* Configuration;
+	list<SADF_Transition*>::iterator Transition;
 
-void SADF_MarkReachableConfigurations(SADF_Configuration* Source) {
+} SADF_TarjanFrame;
 
-	Source->setMarking(true);
+static SADF_TarjanFrame SADF_MakeTarjanFrame(SADF_Configuration* C) {
 
-	for (list<SADF_Transition*>::iterator i = Source->getTransitions().begin(); i != Source->getTransitions().end(); i++)
-		if (!(*i)->getDestination()->isMarked())
-			SADF_MarkReachableConfigurations((*i)->getDestination());
+	SADF_TarjanFrame Frame;
+	Frame.Configuration = C;
+	Frame.Transition = C->getTransitions().begin();
+	return Frame;
 }
 
-bool SADF_TPS::isSingleStronglyConnectedComponent() {
+static CId SADF_TarjanSlot(SADF_Configuration* C, const CSize NumberOfConfigurations) {
 
-	// Precondition: all configurations in configuration space must not be marked
-	
-	bool SingleStronglyConnectedComponent = true;
-	
-	SADF_MarkReachableConfigurations(ConfigurationSpace.front().front());
-	
-	for (SADF_HashedListOfConfigurations::iterator i = ConfigurationSpace.begin(); SingleStronglyConnectedComponent && i != ConfigurationSpace.end(); i++)
-		for (SADF_ListOfConfigurations::iterator j = (*i).begin(); SingleStronglyConnectedComponent && j != (*i).end(); j++)
-			if (!(*j)->isMarked())
-				SingleStronglyConnectedComponent = false;
+	// The initial configuration is not part of the configuration space for all analyses
 
-	return SingleStronglyConnectedComponent;
+	return C->getIdentity() == SADF_UNDEFINED ? NumberOfConfigurations : C->getIdentity();
 }
 
-// Functions to remove transient configurations
+void SADF_TPS::removeTransientConfigurations() {
 
-void SADF_FindRecurrencePoints(SADF_Configuration* Source) {
+	// Precondition: all configurations in configuration space must be relevant
 
-	Source->setMarking(true);
+	// Strongly connected components reachable from the initial configuration are found by an iterative version of Tarjan's
+	// algorithm. A component is recurrent if it has no transitions to other components, all other configurations are transient.
 
-	for (list<SADF_Transition*>::iterator i = Source->getTransitions().begin(); i != Source->getTransitions().end(); i++)
-		if (!(*i)->getDestination()->isMarked())
-			SADF_FindRecurrencePoints((*i)->getDestination());
-		else
-			if ((*i)->getDestination()->isRelevant())
-				(*i)->getDestination()->setRelevance(false);
-}
+	vector<CId> Index(NumberOfConfigurations + 1, SADF_UNDEFINED);
+	vector<CId> LowLink(NumberOfConfigurations + 1, SADF_UNDEFINED);
+	vector<CId> Component(NumberOfConfigurations + 1, SADF_UNDEFINED);
+	vector<bool> OnStack(NumberOfConfigurations + 1, false);
+	vector<bool> Recurrent;
 
-void SADF_RemoveTransitionsUntilRecurrencePoints(SADF_Configuration* Source) {
+	vector<SADF_Configuration*> Stack;
+	vector<SADF_TarjanFrame> Path;
 
-	bool Remove = false;
+	NumberOfRecurrentComponents = 0;
 
-	for (list<SADF_Transition*>::iterator i = Source->getTransitions().begin(); !Remove && i != Source->getTransitions().end(); i++)
-		if (!(*i)->getDestination()->isRelevant())
-			Remove = true;
+	CId Counter = 0;
+	CId Slot = SADF_TarjanSlot(InitialConfiguration, NumberOfConfigurations);
 
-	if (!Remove)
-		for (list<SADF_Transition*>::iterator i = Source->getTransitions().begin(); i != Source->getTransitions().end(); i++)
-			SADF_RemoveTransitionsUntilRecurrencePoints((*i)->getDestination());
+	Index[Slot] = Counter;
+	LowLink[Slot] = Counter;
+	Counter++;
+	OnStack[Slot] = true;
+	Stack.push_back(InitialConfiguration);
+	Path.push_back(SADF_MakeTarjanFrame(InitialConfiguration));
 
-	Source->removeAllTransitions();
-}
+	while (!Path.empty()) {
 
-void SADF_TPS::removeTransientConfigurations() {
+		SADF_Configuration* Source = Path.back().Configuration;
+		CId SourceSlot = SADF_TarjanSlot(Source, NumberOfConfigurations);
 
-	// Precondition: all configurations in configuration space must not be marked and relevant
+		if (Path.back().Transition != Source->getTransitions().end()) {
+
+			SADF_Configuration* Destination = (*Path.back().Transition)->getDestination();
+			CId DestinationSlot = SADF_TarjanSlot(Destination, NumberOfConfigurations);
+			Path.back().Transition++;
+
+			if (Index[DestinationSlot] == SADF_UNDEFINED) {
+				Index[DestinationSlot] = Counter;
+				LowLink[DestinationSlot] = Counter;
+				Counter++;
+				OnStack[DestinationSlot] = true;
+				Stack.push_back(Destination);
+				Path.push_back(SADF_MakeTarjanFrame(Destination));
+			} else if (OnStack[DestinationSlot] && Index[DestinationSlot] < LowLink[SourceSlot])
+				LowLink[SourceSlot] = Index[DestinationSlot];
+
+		} else {
+
+			Path.pop_back();
+
+			if (!Path.empty()) {
+				CId ParentSlot = SADF_TarjanSlot(Path.back().Configuration, NumberOfConfigurations);
+				if (LowLink[SourceSlot] < LowLink[ParentSlot])
+					LowLink[ParentSlot] = LowLink[SourceSlot];
+			}
+
+			if (LowLink[SourceSlot] == Index[SourceSlot]) {
+
+				// Close component, all its transitions lead to configurations in closed components
+
+				CId ComponentID = Recurrent.size();
+
+				vector<SADF_Configuration*>::iterator First = Stack.end();
+
+				do {
+					First--;
+					OnStack[SADF_TarjanSlot(*First, NumberOfConfigurations)] = false;
+					Component[SADF_TarjanSlot(*First, NumberOfConfigurations)] = ComponentID;
+				} while (*First != Source);
+
+				bool Closed = true;
+
+				for (vector<SADF_Configuration*>::iterator i = First; Closed && i != Stack.end(); i++)
+					for (list<SADF_Transition*>::iterator j = (*i)->getTransitions().begin(); Closed && j != (*i)->getTransitions().end(); j++)
+						if (Component[SADF_TarjanSlot((*j)->getDestination(), NumberOfConfigurations)] != ComponentID)
+							Closed = false;
+
+				Recurrent.push_back(Closed);
+
+				if (Closed)
+					NumberOfRecurrentComponents++;
+
+				Stack.erase(First, Stack.end());
+			}
+		}
+	}
+
+	// Remove transient configurations
+
+	if (InitialConfiguration->getIdentity() == SADF_UNDEFINED && !Recurrent[Component[NumberOfConfigurations]])
+		InitialConfiguration->deleteAllTransitions();
 
-	SADF_FindRecurrencePoints(InitialConfiguration);
-	SADF_RemoveTransitionsUntilRecurrencePoints(InitialConfiguration);	
-	
 	for (SADF_HashedListOfConfigurations::iterator i = ConfigurationSpace.begin(); i != ConfigurationSpace.end();) {
 
 		SADF_HashedListOfConfigurations::iterator n = i;
+		SADF_HashKey Key = (*n).front()->getHashKey();
 		i++;
 
 		for (SADF_ListOfConfigurations::iterator j = (*n).begin(); j != (*n).end();) {
 			
 			SADF_ListOfConfigurations::iterator m = j;
 			j++;
-			
-			if ((*m)->getTransitions().empty()) {
+
+			CId ComponentID = Component[(*m)->getIdentity()];
+
+			if (ComponentID == SADF_UNDEFINED || !Recurrent[ComponentID]) {
 				NumberOfConfigurations--;
 				delete *m;
 				(*n).erase(m);
@@ -336,8 +522,10 @@ void SADF_TPS::removeTransientConfigurations() {
 			}
 		}
 	
-		if ((*n).empty())
+		if ((*n).empty()) {
+			ConfigurationIndex.erase(Key);
 			ConfigurationSpace.erase(n);
+		}
 	}
     
     // Reassign identities
@@ -353,31 +541,176 @@ void SADF_TPS::removeTransientConfigurations() {
 
 // Functions to compute equilibrium distribution
 
-vector<CDouble> SADF_TPS::computeEquilibriumDistribution() {
+vector<CDouble> SADF_TPS::computeEquilibriumDistribution(const CDouble Tolerance, const uint NumberOfThreads) {
+
+	// Gaussian elimination fills in the matrix, so it is only used for small chains or when no tolerance is allowed
 
-	// Initialise augmented matrix
+	if (NumberOfConfigurations <= SADF_DIRECT_SOLVER_LIMIT || Tolerance <= 0)
+		return solveEquilibriumDistribution();
+	else
+		return iterateEquilibriumDistribution(Tolerance, NumberOfThreads);
+}
+
+vector<CDouble> SADF_TPS::solveEquilibriumDistribution() {
+
+	// Assemble augmented matrix
 
-    SparseMatrix* Matrix = new SparseMatrix(NumberOfConfigurations);
+	SparseMatrixBuilder Builder(NumberOfConfigurations, NumberOfConfigurations + 1);
 
 	for (SADF_HashedListOfConfigurations::iterator i = ConfigurationSpace.begin(); i != ConfigurationSpace.end(); i++)
 		for (SADF_ListOfConfigurations::iterator j = (*i).begin(); j != (*i).end(); j++)
             for (list<SADF_Transition*>::iterator k = (*j)->getTransitions().begin(); k != (*j)->getTransitions().end(); k++)
 				if ((*k)->getDestination()->getIdentity() < NumberOfConfigurations - 1)
-					Matrix->set((*k)->getDestination()->getIdentity(), (*j)->getIdentity(), (*k)->getProbability());
+					Builder.add((*k)->getDestination()->getIdentity(), (*j)->getIdentity(), (*k)->getProbability());
 		
 	for (CId i = 0; i != NumberOfConfigurations + 1; i++) {
 		
-		Matrix->set(NumberOfConfigurations - 1, i, 1);
+		Builder.add(NumberOfConfigurations - 1, i, 1);
 		
 		if (i < NumberOfConfigurations - 1)
-			Matrix->set(i, i, Matrix->get(i, i) - 1);
+			Builder.add(i, i, -1);
 	}
 
-    vector<CDouble> EquilibriumDistribution = Matrix->computeEigenVector();
+	CompressedSparseMatrix Compressed(Builder);
+	SparseMatrix Matrix(Compressed);
 
-    delete Matrix;
-    
-    return EquilibriumDistribution;
+	return Matrix.computeEigenVector();
+}
+
+// Block Gauss-Seidel iteration for equilibrium distribution
+
+typedef struct _SADF_EquilibriumIteration {
+
+	CSize NumberOfConfigurations;
+	CSize NumberOfBlocks;
+
+	// Incoming transitions of each configuration (row) from other configurations (columns)
+
+	CompressedSparseMatrix* Transitions;
+
+	// Probability of leaving each configuration
+
+	vector<CDouble> Outflow;
+
+	vector<CDouble> Current;
+	vector<CDouble> Next;
+	vector<CDouble> BlockSum;
+	vector<CDouble> BlockDifference;
+	CDouble Sum;
+
+} SADF_EquilibriumIteration;
+
+static void SADF_SweepEquilibriumBlock(void* Arg, const CSize Block, const uint Thread) {
+
+	SADF_EquilibriumIteration* I = (SADF_EquilibriumIteration*)Arg;
+
+	CSize First = Block * I->NumberOfConfigurations / I->NumberOfBlocks;
+	CSize Last = (Block + 1) * I->NumberOfConfigurations / I->NumberOfBlocks;
+
+	// Within a block, new values are used as soon as they are available. Other blocks are only read from the previous iterate.
+
+	CDouble Sum = 0;
+
+	for (CSize d = First; d != Last; d++) {
+
+		CDouble Inflow = 0;
+
+		for (CSize k = I->Transitions->getRowBegin(d); k != I->Transitions->getRowEnd(d); k++) {
+
+			CSize s = I->Transitions->getColumn(k);
+
+			if (s >= First && s < d)
+				Inflow += I->Transitions->getValue(k) * I->Next[s];
+			else
+				Inflow += I->Transitions->getValue(k) * I->Current[s];
+		}
+
+		I->Next[d] = Inflow / I->Outflow[d];
+
+		// Averaging with the previous iterate prevents oscillation on periodic chains
+
+		I->Next[d] = (I->Next[d] + I->Current[d]) / 2;
+
+		Sum += I->Next[d];
+	}
+
+	I->BlockSum[Block] = Sum;
+}
+
+static void SADF_NormaliseEquilibriumBlock(void* Arg, const CSize Block, const uint Thread) {
+
+	SADF_EquilibriumIteration* I = (SADF_EquilibriumIteration*)Arg;
+
+	CSize First = Block * I->NumberOfConfigurations / I->NumberOfBlocks;
+	CSize Last = (Block + 1) * I->NumberOfConfigurations / I->NumberOfBlocks;
+
+	CDouble Difference = 0;
+
+	for (CSize d = First; d != Last; d++) {
+		I->Next[d] /= I->Sum;
+		Difference += fabs(I->Next[d] - I->Current[d]);
+	}
+
+	I->BlockDifference[Block] = Difference;
+}
+
+vector<CDouble> SADF_TPS::iterateEquilibriumDistribution(const CDouble Tolerance, const uint NumberOfThreads) {
+
+	if (NumberOfConfigurations == 1)
+		return vector<CDouble>(1, 1);
+
+	SADF_EquilibriumIteration I;
+
+	// The partition into blocks does not depend on the number of threads, so the result does not either
+
+	I.NumberOfConfigurations = NumberOfConfigurations;
+	I.NumberOfBlocks = (NumberOfConfigurations + SADF_EQUILIBRIUM_BLOCK_SIZE - 1) / SADF_EQUILIBRIUM_BLOCK_SIZE;
+
+	// Collect incoming transitions per destination from the transition lists of all configurations
+
+	SparseMatrixBuilder Builder(NumberOfConfigurations, NumberOfConfigurations);
+
+	I.Outflow.assign(NumberOfConfigurations, 0);
+
+	for (SADF_HashedListOfConfigurations::iterator i = ConfigurationSpace.begin(); i != ConfigurationSpace.end(); i++)
+		for (SADF_ListOfConfigurations::iterator j = (*i).begin(); j != (*i).end(); j++)
+			for (list<SADF_Transition*>::iterator k = (*j)->getTransitions().begin(); k != (*j)->getTransitions().end(); k++)
+				if ((*k)->getDestination() != *j) {
+					Builder.add((*k)->getDestination()->getIdentity(), (*j)->getIdentity(), (*k)->getProbability());
+					I.Outflow[(*j)->getIdentity()] += (*k)->getProbability();
+				}
+
+	CompressedSparseMatrix Transitions(Builder);
+	I.Transitions = &Transitions;
+
+	// Iterate from the uniform distribution until successive iterates differ less than the tolerance
+
+	I.Current.assign(NumberOfConfigurations, 1 / (CDouble)NumberOfConfigurations);
+	I.Next.resize(NumberOfConfigurations);
+	I.BlockSum.resize(I.NumberOfBlocks);
+	I.BlockDifference.resize(I.NumberOfBlocks);
+
+	for (CSize Iteration = 0; Iteration != SADF_MAXIMUM_ITERATIONS; Iteration++) {
+
+		runParallelJobs(SADF_SweepEquilibriumBlock, &I, I.NumberOfBlocks, NumberOfThreads);
+
+		I.Sum = 0;
+		for (CSize b = 0; b != I.NumberOfBlocks; b++)
+			I.Sum += I.BlockSum[b];
+
+		runParallelJobs(SADF_NormaliseEquilibriumBlock, &I, I.NumberOfBlocks, NumberOfThreads);
+
+		CDouble Difference = 0;
+		for (CSize b = 0; b != I.NumberOfBlocks; b++)
+			Difference += I.BlockDifference[b];
+
+		I.Current.swap(I.Next);
+
+		if (Difference < Tolerance)
+			return I.Current;
+	}
+
+	throw CException("Error: Computation of equilibrium distribution does not converge.");
 }
 
 // Print for debug
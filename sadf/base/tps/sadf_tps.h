@@ -39,6 +39,19 @@
 #include "sadf_configuration.h"
 #include "sadf_kernel_status.h"
 #include "sadf_detector_status.h"
+#include <tr1/unordered_map>
+
+// Index from hash keys to lists of configurations in the configuration space
+
+typedef std::tr1::unordered_map<SADF_HashKey, SADF_HashedListOfConfigurations::iterator> SADF_ConfigurationIndex;
+
+// Index of configurations found during concurrent construction, which are not yet added to the configuration space
+
+struct SADF_PendingConfigurations;
+
+// Index of interned contents of control channels
+
+struct SADF_ControlContents;
 
 // SADF_TPS Definition
 
@@ -60,18 +73,28 @@ public:
 	SADF_Configuration* getInitialConfiguration() const { return InitialConfiguration; };
 	list<SADF_ListOfConfigurations>& getConfigurationSpace() { return ConfigurationSpace; };
 	SADF_Configuration* inConfigurationSpace(SADF_Configuration* C);
+	SADF_Configuration* findOrAddConfiguration(SADF_Configuration* C);		// Returns equal configuration if present, otherwise adds C and returns NULL
 	void deleteContentOfConfigurations();
 
 	SADF_KernelState* getInitialKernelState(CId KernelID) const { return InitialKernelStates[KernelID]; };
 	list<SADF_KernelState*>& getKernelStates(CId KernelID) { return KernelStates[KernelID]; };
 	SADF_DetectorState* getInitialDetectorState(CId DetectorID) const { return InitialDetectorStates[DetectorID]; };
 	list<SADF_DetectorState*>& getDetectorStates(CId DetectorID) { return DetectorStates[DetectorID]; };
+	SADF_ControlContent* internControlContent(const CQueue& Numbers, const CQueue& Content);	// Safe to use during concurrent construction
+	SADF_StatusPool* getStatusPool() const { return StatusPool; };		// NULL unless state space is spilled to disk
+
+	// Concurrent construction (configurations found by findOrAddConfiguration remain pending without identity until added to the configuration space)
+
+	void beginConcurrentConstruction();
+	void clearPendingConfigurations();					// Precondition: all pending configurations have been added to the configuration space
+	void endConcurrentConstruction();					// Deletes pending configurations that are not added to the configuration space
+	bool isConcurrentConstruction() const { return !PendingConfigurations.empty(); };
 
 	// Functions for analysis
 
-	void removeTransientConfigurations();		        // Precondition: all configurations in configuration space must not be marked and relevant, while transitions exist
-	bool isSingleStronglyConnectedComponent();	        // Precondition: all configurations in configuration space must not be marked
-	vector<CDouble> computeEquilibriumDistribution();
+	void removeTransientConfigurations();		        // Precondition: all configurations in configuration space must be relevant, while transitions exist
+	bool isSingleStronglyConnectedComponent() const { return NumberOfRecurrentComponents == 1; };	// Precondition: transient configurations have been removed
+	vector<CDouble> computeEquilibriumDistribution(const CDouble Tolerance = SADF_DEFAULT_TOLERANCE, const uint NumberOfThreads = 1);
 
 	// Print for debug (Process States)
 
@@ -79,17 +102,27 @@ public:
 	void print2DOT(ostream& out, SADF_Graph* Graph);
 
 private:
+	// Solvers for equilibrium distribution
+
+	vector<CDouble> solveEquilibriumDistribution();
+	vector<CDouble> iterateEquilibriumDistribution(const CDouble Tolerance, const uint NumberOfThreads);
+
 	// Instance Variables
 	
 	CSize NumberOfConfigurations;
+	CSize NumberOfRecurrentComponents;
 
 	vector< list<SADF_KernelState*> > KernelStates;
 	vector< list<SADF_DetectorState*> > DetectorStates;
 	vector<SADF_KernelState*> InitialKernelStates;
 	vector<SADF_DetectorState*> InitialDetectorStates;
+	SADF_ControlContents* ControlContents;
+	SADF_StatusPool* StatusPool;
 
 	SADF_Configuration* InitialConfiguration;
 	SADF_HashedListOfConfigurations ConfigurationSpace;
+	SADF_ConfigurationIndex ConfigurationIndex;
+	vector<SADF_PendingConfigurations*> PendingConfigurations;
 };
 
 #endif
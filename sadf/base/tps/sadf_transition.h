@@ -42,6 +42,11 @@
 
 class SADF_Configuration;
 
+// Type definitions
+
+typedef list<SADF_Configuration*> SADF_ListOfConfigurations;
+typedef list<SADF_ListOfConfigurations> SADF_HashedListOfConfigurations;
+
 // SADF_Transition Definition
 
 class SADF_Transition {
@@ -45,6 +45,7 @@
 
 // Analysis of SADF Graphs
 #include "analysis/graph/sadf_state_space.h"
+#include "analysis/graph/sadf_long_run_metrics.h"
 #include "analysis/process/sadf_inter_firing_latency.h"
 #include "analysis/process/sadf_response_delay.h"
 #include "analysis/process/sadf_deadline_miss.h"
@@ -52,6 +53,7 @@
 
 // Simulation of SADF Graphs
 #include "simulation/settings/sadf_settings.h"
+#include "simulation/engine/sadf_simulation.h"
 
 // Printing Facilities for SADF Graphs
 #include "print/xml/sadf2xml.h"
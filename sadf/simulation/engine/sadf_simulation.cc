@@ -0,0 +1,356 @@
+/*
+ *  Eindhoven University of Technology
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   sadf_simulation.cc
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   17 October 2026
+ *
+ *  Function        :   Monte-Carlo simulation of SADF graphs
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ * 
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+
+#include "sadf_simulation.h"
+
+// Observations of a single replication
+
+typedef struct _SADF_Replication {
+
+	vector<CDouble> Firings;
+	vector<CDouble> ResponseDelay;			// Negative if process did not complete any firing
+	vector<CDouble> InterFiringLatencies;
+	vector<CDouble> DeadlineMisses;
+	vector<CDouble> Occupancy;				// Integral of occupancy over time
+	vector<CDouble> MaximumOccupancy;
+	CSize NumberOfSteps;
+
+} SADF_Replication;
+
+// Administration of all replications of a simulation
+
+typedef struct _SADF_Simulation {
+
+	SADF_Graph* Graph;
+	SADF_TPS* TPS;
+	CDouble ModelTime;
+	CDouble WarmUp;
+	CDouble Deadline;
+	unsigned long Seed;
+	vector<SADF_Replication>* Replications;
+
+} SADF_Simulation;
+
+static void SADF_SimulateReplication(void* Arg, const CSize Replication, const uint Thread) {
+
+	SADF_Simulation* S = (SADF_Simulation*)Arg;
+	SADF_Graph* Graph = S->Graph;
+	SADF_Replication& R = (*S->Replications)[Replication];
+
+	CId NumberOfProcesses = Graph->getNumberOfKernels() + Graph->getNumberOfDetectors();
+	CId NumberOfChannels = Graph->getNumberOfDataChannels() + Graph->getNumberOfControlChannels();
+
+	R.Firings.assign(NumberOfProcesses, 0);
+	R.ResponseDelay.assign(NumberOfProcesses, -1);
+	R.InterFiringLatencies.assign(NumberOfProcesses, 0);
+	R.DeadlineMisses.assign(NumberOfProcesses, 0);
+	R.Occupancy.assign(NumberOfChannels, 0);
+	R.MaximumOccupancy.assign(NumberOfChannels, 0);
+	R.NumberOfSteps = 0;
+
+	// Each replication uses its own stream of random numbers
+
+	MTRand Random(S->Seed + Replication);
+
+	vector<CDouble> LastEnd(NumberOfProcesses, -1);
+	vector<CDouble> Occupation(NumberOfChannels, 0);
+
+	CDouble Time = 0;
+
+	// Configurations are not stored in the TPS, only the current one is kept
+
+	SADF_Configuration* Current = new SADF_Configuration(Graph, S->TPS->getInitialConfiguration(), S->TPS->getInitialConfiguration()->getType(), 0);
+
+	try {
+
+		while (Time < S->ModelTime) {
+
+			SADF_Process* Actor;
+			SADF_ListOfConfigurations NewConfigurations = SADF_ProgressTPS_ASAP_Resolved(Graph, S->TPS, Current, Actor, false);
+
+			// Sample next configuration (for detect and start steps, the probabilities stem from Markov chains and execution time distributions)
+
+			SADF_Configuration* Next = NULL;
+			CDouble Sample = Random.randExc();
+
+			for (list<SADF_Transition*>::iterator i = Current->getTransitions().begin(); Next == NULL && i != Current->getTransitions().end(); i++) {
+				Sample -= (*i)->getProbability();
+				if (Sample < 0)
+					Next = (*i)->getDestination();
+			}
+
+			if (Next == NULL)
+				Next = Current->getTransitions().back()->getDestination();	// Circumvent rounding errors
+
+			// Observe current configuration
+
+			for (CId c = 0; c != Graph->getNumberOfDataChannels(); c++)
+				Occupation[c] = Current->getChannelStatus(c)->getOccupation();
+
+			for (CId c = 0; c != Graph->getNumberOfControlChannels(); c++)
+				Occupation[Graph->getNumberOfDataChannels() + c] = Current->getControlStatus(c)->getOccupation();
+
+			if (Time >= S->WarmUp)
+				for (CId c = 0; c != NumberOfChannels; c++)
+					if (Occupation[c] > R.MaximumOccupancy[c])
+						R.MaximumOccupancy[c] = Occupation[c];
+
+			if (Actor == NULL) {
+
+				CDouble Duration = Current->getMinimalRemainingExecutionTime();
+
+				CDouble Begin = (Time < S->WarmUp) ? S->WarmUp : Time;
+				CDouble End = (Time + Duration > S->ModelTime) ? S->ModelTime : Time + Duration;
+
+				if (End > Begin)
+					for (CId c = 0; c != NumberOfChannels; c++)
+						R.Occupancy[c] += (End - Begin) * Occupation[c];
+
+				Time += Duration;
+
+			} else if (Next->getType() == SADF_END_STEP) {
+
+				CId p = Actor->getIdentity();
+
+				if (Actor->getType() == SADF_DETECTOR)
+					p += Graph->getNumberOfKernels();
+
+				if (R.ResponseDelay[p] < 0)
+					R.ResponseDelay[p] = Time;
+
+				if (Time >= S->WarmUp) {
+
+					R.Firings[p]++;
+
+					if (LastEnd[p] >= 0) {
+						R.InterFiringLatencies[p]++;
+						if (Time - LastEnd[p] > S->Deadline)
+							R.DeadlineMisses[p]++;
+					}
+				}
+
+				LastEnd[p] = Time;
+			}
+
+			for (SADF_ListOfConfigurations::iterator i = NewConfigurations.begin(); i != NewConfigurations.end(); i++)
+				if (*i != Next)
+					delete *i;
+
+			delete Current;
+			Current = Next;
+
+			R.NumberOfSteps++;
+		}
+
+	} catch (CException& e) {
+		delete Current;
+		throw;
+	}
+
+	delete Current;
+}
+
+// Probability mass of Student's t-distribution between 0 and X by Simpson's rule
+
+static CDouble SADF_StudentMass(const CDouble X, const CDouble DegreesOfFreedom) {
+
+	CDouble N = DegreesOfFreedom;
+	CDouble Constant = exp(lgamma((N + 1) / 2) - lgamma(N / 2)) / sqrt(N * M_PI);
+
+	CSize Intervals = 1000;
+	CDouble Step = X / Intervals;
+	CDouble Mass = 0;
+
+	for (CSize i = 0; i <= Intervals; i++) {
+		CDouble Weight = (i == 0 || i == Intervals) ? 1 : ((i % 2 == 1) ? 4 : 2);
+		Mass += Weight * Constant * pow(1 + (i * Step) * (i * Step) / N, -(N + 1) / 2);
+	}
+
+	return Mass * Step / 3;
+}
+
+// Quantile of Student's t-distribution for probabilities above 0.5 by bisection
+
+static CDouble SADF_StudentQuantile(const CDouble Probability, const CSize DegreesOfFreedom) {
+
+	CDouble Low = 0;
+	CDouble High = 1;
+
+	while (SADF_StudentMass(High, DegreesOfFreedom) < Probability - 0.5) {
+		Low = High;
+		High *= 2;
+	}
+
+	for (CSize i = 0; i != 50; i++) {
+
+		CDouble Middle = (Low + High) / 2;
+
+		if (SADF_StudentMass(Middle, DegreesOfFreedom) < Probability - 0.5)
+			Low = Middle;
+		else
+			High = Middle;
+	}
+
+	return (Low + High) / 2;
+}
+
+static SADF_Estimate SADF_ComputeEstimate(const vector<CDouble>& Samples, const CDouble Confidence) {
+
+	SADF_Estimate E;
+
+	E.NumberOfSamples = Samples.size();
+	E.Mean = 0;
+	E.HalfWidth = 0;
+
+	if (Samples.empty())
+		return E;
+
+	for (CSize i = 0; i != Samples.size(); i++)
+		E.Mean += Samples[i];
+
+	E.Mean /= Samples.size();
+
+	if (Samples.size() < 2)
+		return E;
+
+	CDouble Variance = 0;
+
+	for (CSize i = 0; i != Samples.size(); i++)
+		Variance += (Samples[i] - E.Mean) * (Samples[i] - E.Mean);
+
+	Variance /= Samples.size() - 1;
+
+	E.HalfWidth = SADF_StudentQuantile((1 + Confidence) / 2, Samples.size() - 1) * sqrt(Variance / Samples.size());
+
+	return E;
+}
+
+// Function to simulate SADF graph
+
+CSize SADF_Simulate(SADF_Graph* Graph, const CDouble ModelTime, const CDouble WarmUp, const CDouble Deadline, SADF_SimulationResults& Results, const CSize NumberOfReplications, const CDouble Confidence, const unsigned long Seed, const uint NumberOfThreads) {
+
+	// Check whether graph satisfied required properties
+
+	if (!SADF_Verify_SingleComponent(Graph))
+		throw CException((CString)("Error: SADF graph '") + Graph->getName() + "' does not consist of a single component.");
+
+	if (!SADF_Verify_Timed(Graph))
+		throw CException((CString)("Error: SADF graph '") + Graph->getName() + "' is not timed.");
+
+	if (WarmUp < 0 || ModelTime <= WarmUp)
+		throw CException("Error: Simulated model time must exceed a non-negative warm-up period.");
+
+	if (NumberOfReplications < 2)
+		throw CException("Error: At least two replications are required to estimate confidence intervals.");
+
+	if (Confidence <= 0 || Confidence >= 1)
+		throw CException("Error: Confidence level must be between 0 and 1.");
+
+	// Simulate independent replications; the TPS only provides the local state spaces of all processes and control channel contents
+
+	SADF_TPS* TPS = new SADF_TPS(Graph);
+
+	vector<SADF_Replication> Replications(NumberOfReplications);
+
+	SADF_Simulation Simulation;
+	Simulation.Graph = Graph;
+	Simulation.TPS = TPS;
+	Simulation.ModelTime = ModelTime;
+	Simulation.WarmUp = WarmUp;
+	Simulation.Deadline = Deadline;
+	Simulation.Seed = Seed;
+	Simulation.Replications = &Replications;
+
+	try {
+		runParallelJobs(SADF_SimulateReplication, &Simulation, NumberOfReplications, NumberOfThreads);
+	} catch (CException& e) {
+		delete TPS;
+		throw;
+	}
+
+	delete TPS;
+
+	// Compute estimates over replications
+
+	CId NumberOfProcesses = Graph->getNumberOfKernels() + Graph->getNumberOfDetectors();
+	CId NumberOfChannels = Graph->getNumberOfDataChannels() + Graph->getNumberOfControlChannels();
+
+	CSize NumberOfSteps = 0;
+
+	for (CSize r = 0; r != NumberOfReplications; r++)
+		NumberOfSteps += Replications[r].NumberOfSteps;
+
+	Results.Throughput.resize(NumberOfProcesses);
+	Results.ResponseDelay.resize(NumberOfProcesses);
+	Results.DeadlineMissProbability.resize(NumberOfProcesses);
+
+	for (CId p = 0; p != NumberOfProcesses; p++) {
+
+		vector<CDouble> Throughput;
+		vector<CDouble> ResponseDelay;
+		vector<CDouble> DeadlineMissProbability;
+
+		for (CSize r = 0; r != NumberOfReplications; r++) {
+
+			Throughput.push_back(Replications[r].Firings[p] / (ModelTime - WarmUp));
+
+			if (Replications[r].ResponseDelay[p] >= 0)
+				ResponseDelay.push_back(Replications[r].ResponseDelay[p]);
+
+			if (Replications[r].InterFiringLatencies[p] != 0)
+				DeadlineMissProbability.push_back(Replications[r].DeadlineMisses[p] / Replications[r].InterFiringLatencies[p]);
+		}
+
+		Results.Throughput[p] = SADF_ComputeEstimate(Throughput, Confidence);
+		Results.ResponseDelay[p] = SADF_ComputeEstimate(ResponseDelay, Confidence);
+		Results.DeadlineMissProbability[p] = SADF_ComputeEstimate(DeadlineMissProbability, Confidence);
+	}
+
+	Results.AverageBufferOccupancy.resize(NumberOfChannels);
+	Results.MaximumBufferOccupancy.assign(NumberOfChannels, 0);
+
+	for (CId c = 0; c != NumberOfChannels; c++) {
+
+		vector<CDouble> Occupancy;
+
+		for (CSize r = 0; r != NumberOfReplications; r++) {
+
+			Occupancy.push_back(Replications[r].Occupancy[c] / (ModelTime - WarmUp));
+
+			if (Replications[r].MaximumOccupancy[c] > Results.MaximumBufferOccupancy[c])
+				Results.MaximumBufferOccupancy[c] = Replications[r].MaximumOccupancy[c];
+		}
+
+		Results.AverageBufferOccupancy[c] = SADF_ComputeEstimate(Occupancy, Confidence);
+	}
+
+	return NumberOfSteps;
+}
@@ -0,0 +1,69 @@
+/*
+ *  Eindhoven University of Technology
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   sadf_simulation.h
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   17 October 2026
+ *
+ *  Function        :   Monte-Carlo simulation of SADF graphs
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ * 
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+
+#ifndef SADF_SIMULATION_H_INCLUDED
+#define SADF_SIMULATION_H_INCLUDED
+
+// Include required verification algorithms
+
+#include "../../verification/simple/sadf_simple.h"
+
+// Include scheduler and type definitions
+
+#include "../../analysis/schedulers/sadf_asap.h"
+
+// Estimate of a performance metric from independent replications
+
+typedef struct _SADF_Estimate {
+
+	CDouble Mean;
+	CDouble HalfWidth;			// Half width of confidence interval around mean
+	CSize NumberOfSamples;		// Number of replications that yielded a sample
+
+} SADF_Estimate;
+
+// Estimates for all processes (kernels followed by detectors) and all channels (data channels followed by control channels)
+
+typedef struct _SADF_SimulationResults {
+
+	vector<SADF_Estimate> Throughput;
+	vector<SADF_Estimate> ResponseDelay;
+	vector<SADF_Estimate> DeadlineMissProbability;		// Fraction of inter-firing latencies exceeding the deadline
+	vector<SADF_Estimate> AverageBufferOccupancy;
+	vector<CDouble> MaximumBufferOccupancy;				// Maximum observed in any replication
+
+} SADF_SimulationResults;
+
+// Function to estimate performance metrics by simulating an SADF graph according to the ASAP schedule (returns number of steps simulated)
+
+CSize SADF_Simulate(SADF_Graph* Graph, const CDouble ModelTime, const CDouble WarmUp, const CDouble Deadline, SADF_SimulationResults& Results, const CSize NumberOfReplications = SADF_DEFAULT_REPLICATIONS, const CDouble Confidence = SADF_DEFAULT_CONFIDENCE, const unsigned long Seed = 0, const uint NumberOfThreads = 1);
+
+#endif
@@ -57,6 +57,14 @@ typedef struct _Settings
     
     // Switch argument(s) given to analysis algorithm
     CPairs arguments;
+
+    // Convergence bound for long-run analyses of large Markov chains
+    CDouble tolerance;
+    // Number of threads used for state-space construction and long-run analyses
+    uint nrThreads;
+
+    // Directory for temporary files holding large state spaces ("" = memory)
+    CString spillDir;
     
     // Application graph
     CNode *xmlAppGraph;
@@ -77,9 +85,15 @@ void helpMessage(ostream &out)
     out << "SDF3 " << TOOL << " (version " << DOTTED_VERSION ")" << endl;
     out << endl;
     out << "Usage: " << TOOL << " --graph <file> --check <proporty>";
-    out << " [--output <file>]" << endl;
+    out << " [--output <file>] [--tolerance <value>] [--threads <n>]";
+    out << " [--spill <dir>]" << endl;
     out << "   --graph  <file>      input SADF graph" << endl;
     out << "   --output <file>      output file (default: stdout)" << endl;
+    out << "   --tolerance <value>  convergence bound for the equilibrium" << endl;
+    out << "                        distribution of large Markov chains" << endl;
+    out << "                        (default: " << SADF_DEFAULT_TOLERANCE << ", 0: exact)" << endl;
+    out << "   --threads <n>        number of threads (default: 1)" << endl;
+    out << "   --spill <dir>        keep state spaces in temporary files in <dir>" << endl;
     out << "   --compute <property> compute requested property for graph:" << endl;
     out << "       number_of_states[(resolve_non_determinism)]" << endl;
     out << "       throughput[(<process>)]" << endl;
@@ -87,6 +101,14 @@ void helpMessage(ostream &out)
     out << "       response_delay(minimum|maximum|expected[,process(<process>)])" << endl;
     out << "       deadline_miss(response|periodic,process(<process>),deadline(<value>))" << endl;
     out << "       buffer_occupancy(maximum|average|variance[,channel(<channel>)])" << endl;
+    out << "       long_run_metrics (throughput, average inter-firing latency and" << endl;
+    out << "       average and variance in buffer occupancy of all processes and" << endl;
+    out << "       channels from a single state space)" << endl;
+    out << "       simulation(model_time(<value>)[,warm_up(<value>),deadline(<value>)," << endl;
+    out << "       replications(<n>),confidence(<value>),seed(<n>)]) (estimates of" << endl;
+    out << "       throughput, response delay, deadline miss probability and average" << endl;
+    out << "       and maximum buffer occupancy of all processes and channels from" << endl;
+    out << "       independent simulation runs)" << endl;
 //    out << "       buffer_size[(<channel>)]" << endl;
 }
 
@@ -188,6 +210,32 @@ void parseCommandLine(int argc, char ** argv)
             arg++;
             settings.arguments = parseSwitchArgument(argv[arg]);
         }
+        else if (argv[arg] == CString("--tolerance") && arg+1<argc)
+        {
+            arg++;
+            settings.tolerance = CString(argv[arg]);
+        }
+        else if (argv[arg] == CString("--threads") && arg+1<argc)
+        {
+            int nrThreads;
+
+            arg++;
+            nrThreads = CString(argv[arg]);
+
+            if (nrThreads < 1)
+                throw CException("Number of threads must be at least one.");
+
+            // More threads than processors do not speed up the analysis
+            if ((uint)nrThreads > nrProcessorsOnline())
+                nrThreads = nrProcessorsOnline();
+
+            settings.nrThreads = nrThreads;
+        }
+        else if (argv[arg] == CString("--spill") && arg+1<argc)
+        {
+            arg++;
+            settings.spillDir = argv[arg];
+        }
         else
         {
             helpMessage(cerr);
@@ -236,9 +284,16 @@ CNode *loadApplicationGraphFromFile(CString &file, CString module)
  */
 void initSettings(int argc, char **argv)
 {
+    // Defaults
+    settings.tolerance = SADF_DEFAULT_TOLERANCE;
+    settings.nrThreads = 1;
+
     // Parse the command line
     parseCommandLine(argc, argv);
 
+    // State spaces are paged to disk when memory runs short
+    CArena::setSpillDirectory(settings.spillDir);
+
     // Check required settings
     if (settings.graphFile.empty() || settings.arguments.size() == 0)
     {
@@ -279,6 +334,37 @@ void SADF_PrintPerformanceResultForChannel(ostream& out, const CString &ChannelN
 	out << ")" << endl;
 }
 
+void SADF_PrintEstimateForProcess(ostream& out, const CString &ProcessName, CId ProcessType, const SADF_Estimate& Estimate, CTimer T) {
+
+	if (ProcessType == SADF_KERNEL)
+		out << "Kernel '";
+	else
+		out << "Detector '";
+
+	out << ProcessName << "': ";
+
+	if (Estimate.NumberOfSamples == 0)
+		out << "no observations";
+	else
+		out << Estimate.Mean << " +/- " << Estimate.HalfWidth;
+
+	out << "	(#Samples: " << Estimate.NumberOfSamples << ", Simulation Time: ";
+	printTimer(out, &T);
+	out << ")" << endl;
+}
+
+void SADF_PrintEstimateForChannel(ostream& out, const CString &ChannelName, CId ChannelType, const SADF_Estimate& Estimate, CTimer T) {
+
+	if (ChannelType == SADF_DATA_CHANNEL)
+		out << "Data channel '";
+	else
+		out << "Control channel '";
+
+	out << ChannelName << "': " << Estimate.Mean << " +/- " << Estimate.HalfWidth << "	(#Samples: " << Estimate.NumberOfSamples << ", Simulation Time: ";
+	printTimer(out, &T);
+	out << ")" << endl;
+}
+
 /**
  * SADF_AnalyzeGraph()
  * The function that calls the actual analysis functions
@@ -299,9 +385,9 @@ void SADF_AnalyzeGraph(SADF_Graph* Graph, CPairs &analyze, ostream &out) {
 				ResolveNonDeterminism = true;
 
 		if (ResolveNonDeterminism)
-			out << "SADF graph '" << Graph->getName() << "' implies a Markov chain with " << SADF_Analyse_NumberOfStates_Resolved(Graph) << " unique states." << endl;
+			out << "SADF graph '" << Graph->getName() << "' implies a Markov chain with " << SADF_Analyse_NumberOfStates_Resolved(Graph, settings.nrThreads) << " unique states." << endl;
 		else
-			out << "SADF graph '" << Graph->getName() << "' implies a Markov Decision Process with " << SADF_Analyse_NumberOfStates(Graph) << " unique states." << endl;
+			out << "SADF graph '" << Graph->getName() << "' implies a Markov Decision Process with " << SADF_Analyse_NumberOfStates(Graph, settings.nrThreads) << " unique states." << endl;
 	
 	} else if (analyze.front().key == "inter_firing_latency") {
 
@@ -363,7 +449,7 @@ void SADF_AnalyzeGraph(SADF_Graph* Graph, CPairs &analyze, ostream &out) {
 				startTimer(&T);
 				
 				if (MetricType == "average" || MetricType == "variance")
-					NumberOfConfigurations = SADF_Analyse_LongRunInterFiringLatency(Graph, SADF_KERNEL, i, Average, Variance);
+					NumberOfConfigurations = SADF_Analyse_LongRunInterFiringLatency(Graph, SADF_KERNEL, i, Average, Variance, settings.tolerance, settings.nrThreads);
 				else
 					NumberOfConfigurations = SADF_Analyse_ExtreemInterFiringLatency(Graph, SADF_KERNEL, i, Minimum, Maximum);
 				
@@ -385,7 +471,7 @@ void SADF_AnalyzeGraph(SADF_Graph* Graph, CPairs &analyze, ostream &out) {
 				startTimer(&T);
 				
 				if (MetricType == "average" || MetricType == "variance")
-					NumberOfConfigurations = SADF_Analyse_LongRunInterFiringLatency(Graph, SADF_DETECTOR, i, Average, Variance);
+					NumberOfConfigurations = SADF_Analyse_LongRunInterFiringLatency(Graph, SADF_DETECTOR, i, Average, Variance, settings.tolerance, settings.nrThreads);
 				else
 					NumberOfConfigurations = SADF_Analyse_ExtreemInterFiringLatency(Graph, SADF_DETECTOR, i, Minimum, Maximum);
 				
@@ -416,7 +502,7 @@ void SADF_AnalyzeGraph(SADF_Graph* Graph, CPairs &analyze, ostream &out) {
 			startTimer(&T);
 	
 			if (MetricType == "average" || MetricType == "variance")
-				NumberOfConfigurations = SADF_Analyse_LongRunInterFiringLatency(Graph, ProcessType, ProcessID, Average, Variance);
+				NumberOfConfigurations = SADF_Analyse_LongRunInterFiringLatency(Graph, ProcessType, ProcessID, Average, Variance, settings.tolerance, settings.nrThreads);
 			else
 				NumberOfConfigurations = SADF_Analyse_ExtreemInterFiringLatency(Graph, ProcessType, ProcessID, Minimum, Maximum);
 			
@@ -432,6 +518,142 @@ void SADF_AnalyzeGraph(SADF_Graph* Graph, CPairs &analyze, ostream &out) {
 				SADF_PrintPerformanceResultForProcess(out, Process->getName(), ProcessType, Maximum, NumberOfConfigurations, T);
 		}
 		
+	} else if (analyze.front().key == "long_run_metrics") {
+
+		vector<CDouble> Throughput;
+		vector<CDouble> AverageBufferOccupancy;
+		vector<CDouble> VarianceBufferOccupancy;
+
+		CTimer T;
+		startTimer(&T);
+		CSize NumberOfConfigurations = SADF_Analyse_LongRunMetrics(Graph, Throughput, AverageBufferOccupancy, VarianceBufferOccupancy, settings.tolerance, settings.nrThreads);
+		stopTimer(&T);
+
+		CId NumberOfKernels = Graph->getNumberOfKernels();
+		CId NumberOfDataChannels = Graph->getNumberOfDataChannels();
+
+		out << "---- Throughput of all processes for SADF graph '" << Graph->getName() << "' ----" << endl;
+
+		for (CId i = 0; i != Graph->getNumberOfKernels(); i++)
+			SADF_PrintPerformanceResultForProcess(out, Graph->getKernel(i)->getName(), SADF_KERNEL, Throughput[i], NumberOfConfigurations, T);
+
+		for (CId i = 0; i != Graph->getNumberOfDetectors(); i++)
+			SADF_PrintPerformanceResultForProcess(out, Graph->getDetector(i)->getName(), SADF_DETECTOR, Throughput[NumberOfKernels + i], NumberOfConfigurations, T);
+
+		out << "---- Average inter-firing latencies of all processes for SADF graph '" << Graph->getName() << "' ----" << endl;
+
+		for (CId i = 0; i != Graph->getNumberOfKernels(); i++)
+			SADF_PrintPerformanceResultForProcess(out, Graph->getKernel(i)->getName(), SADF_KERNEL, 1 / Throughput[i], NumberOfConfigurations, T);
+
+		for (CId i = 0; i != Graph->getNumberOfDetectors(); i++)
+			SADF_PrintPerformanceResultForProcess(out, Graph->getDetector(i)->getName(), SADF_DETECTOR, 1 / Throughput[NumberOfKernels + i], NumberOfConfigurations, T);
+
+		out << "---- Average buffer occupancy of all channels for SADF graph '" << Graph->getName() << "' ----" << endl;
+
+		for (CId i = 0; i != Graph->getNumberOfDataChannels(); i++)
+			SADF_PrintPerformanceResultForChannel(out, Graph->getDataChannel(i)->getName(), SADF_DATA_CHANNEL, AverageBufferOccupancy[i], NumberOfConfigurations, T);
+
+		for (CId i = 0; i != Graph->getNumberOfControlChannels(); i++)
+			SADF_PrintPerformanceResultForChannel(out, Graph->getControlChannel(i)->getName(), SADF_CONTROL_CHANNEL, AverageBufferOccupancy[NumberOfDataChannels + i], NumberOfConfigurations, T);
+
+		out << "---- Variance in buffer occupancy of all channels for SADF graph '" << Graph->getName() << "' ----" << endl;
+
+		for (CId i = 0; i != Graph->getNumberOfDataChannels(); i++)
+			SADF_PrintPerformanceResultForChannel(out, Graph->getDataChannel(i)->getName(), SADF_DATA_CHANNEL, VarianceBufferOccupancy[i], NumberOfConfigurations, T);
+
+		for (CId i = 0; i != Graph->getNumberOfControlChannels(); i++)
+			SADF_PrintPerformanceResultForChannel(out, Graph->getControlChannel(i)->getName(), SADF_CONTROL_CHANNEL, VarianceBufferOccupancy[NumberOfDataChannels + i], NumberOfConfigurations, T);
+
+	} else if (analyze.front().key == "simulation") {
+
+		// Determine simulation parameters
+
+		CPairs options = parseSwitchArgument(analyze.front().value);
+
+		CDouble ModelTime = 0;
+		CDouble WarmUp = 0;
+		CDouble Deadline = 0;
+		CSize Replications = SADF_DEFAULT_REPLICATIONS;
+		CDouble Confidence = SADF_DEFAULT_CONFIDENCE;
+		unsigned long Seed = 0;
+		bool DeadlineDefined = false;
+
+		for (CPairsIter i = options.begin(); i != options.end(); i++) {
+			if ((*i).key == "model_time")
+				ModelTime = (*i).value;
+			if ((*i).key == "warm_up")
+				WarmUp = (*i).value;
+			if ((*i).key == "deadline") {
+				Deadline = (*i).value;
+				DeadlineDefined = true;
+			}
+			if ((*i).key == "replications")
+				Replications = (*i).value;
+			if ((*i).key == "confidence")
+				Confidence = (*i).value;
+			if ((*i).key == "seed")
+				Seed = (*i).value;
+		}
+
+		if (ModelTime <= 0)
+			throw CException("Error: No positive model time specified.");
+
+		if (DeadlineDefined && Deadline <= 0)
+			throw CException("Error: Deadline must be positive.");
+
+		SADF_SimulationResults Results;
+
+		CTimer T;
+		startTimer(&T);
+		SADF_Simulate(Graph, ModelTime, WarmUp, DeadlineDefined ? Deadline : SADF_MAX_DOUBLE, Results, Replications, Confidence, Seed, settings.nrThreads);
+		stopTimer(&T);
+
+		CId NumberOfKernels = Graph->getNumberOfKernels();
+		CId NumberOfDataChannels = Graph->getNumberOfDataChannels();
+
+		out << "---- Estimated throughput of all processes for SADF graph '" << Graph->getName() << "' ----" << endl;
+
+		for (CId i = 0; i != Graph->getNumberOfKernels(); i++)
+			SADF_PrintEstimateForProcess(out, Graph->getKernel(i)->getName(), SADF_KERNEL, Results.Throughput[i], T);
+
+		for (CId i = 0; i != Graph->getNumberOfDetectors(); i++)
+			SADF_PrintEstimateForProcess(out, Graph->getDetector(i)->getName(), SADF_DETECTOR, Results.Throughput[NumberOfKernels + i], T);
+
+		out << "---- Estimated response delay of all processes for SADF graph '" << Graph->getName() << "' ----" << endl;
+
+		for (CId i = 0; i != Graph->getNumberOfKernels(); i++)
+			SADF_PrintEstimateForProcess(out, Graph->getKernel(i)->getName(), SADF_KERNEL, Results.ResponseDelay[i], T);
+
+		for (CId i = 0; i != Graph->getNumberOfDetectors(); i++)
+			SADF_PrintEstimateForProcess(out, Graph->getDetector(i)->getName(), SADF_DETECTOR, Results.ResponseDelay[NumberOfKernels + i], T);
+
+		if (DeadlineDefined) {
+
+			out << "---- Estimated periodic deadline miss probability of all processes for SADF graph '" << Graph->getName() << "' ----" << endl;
+
+			for (CId i = 0; i != Graph->getNumberOfKernels(); i++)
+				SADF_PrintEstimateForProcess(out, Graph->getKernel(i)->getName(), SADF_KERNEL, Results.DeadlineMissProbability[i], T);
+
+			for (CId i = 0; i != Graph->getNumberOfDetectors(); i++)
+				SADF_PrintEstimateForProcess(out, Graph->getDetector(i)->getName(), SADF_DETECTOR, Results.DeadlineMissProbability[NumberOfKernels + i], T);
+		}
+
+		out << "---- Estimated average buffer occupancy of all channels for SADF graph '" << Graph->getName() << "' ----" << endl;
+
+		for (CId i = 0; i != Graph->getNumberOfDataChannels(); i++)
+			SADF_PrintEstimateForChannel(out, Graph->getDataChannel(i)->getName(), SADF_DATA_CHANNEL, Results.AverageBufferOccupancy[i], T);
+
+		for (CId i = 0; i != Graph->getNumberOfControlChannels(); i++)
+			SADF_PrintEstimateForChannel(out, Graph->getControlChannel(i)->getName(), SADF_CONTROL_CHANNEL, Results.AverageBufferOccupancy[NumberOfDataChannels + i], T);
+
+		out << "---- Observed maximum buffer occupancy of all channels for SADF graph '" << Graph->getName() << "' ----" << endl;
+
+		for (CId i = 0; i != Graph->getNumberOfDataChannels(); i++)
+			out << "Data channel '" << Graph->getDataChannel(i)->getName() << "': " << Results.MaximumBufferOccupancy[i] << endl;
+
+		for (CId i = 0; i != Graph->getNumberOfControlChannels(); i++)
+			out << "Control channel '" << Graph->getControlChannel(i)->getName() << "': " << Results.MaximumBufferOccupancy[NumberOfDataChannels + i] << endl;
+
 	} else if (analyze.front().key == "throughput") {
 
 		// Determine metric type
@@ -475,7 +697,7 @@ void SADF_AnalyzeGraph(SADF_Graph* Graph, CPairs &analyze, ostream &out) {
 			
 				CTimer T;
 				startTimer(&T);
-				NumberOfConfigurations = SADF_Analyse_LongRunInterFiringLatency(Graph, SADF_KERNEL, i, Average, Variance);
+				NumberOfConfigurations = SADF_Analyse_LongRunInterFiringLatency(Graph, SADF_KERNEL, i, Average, Variance, settings.tolerance, settings.nrThreads);
 				stopTimer(&T);
 				SADF_PrintPerformanceResultForProcess(out, Graph->getKernel(i)->getName(), SADF_KERNEL, 1 / Average, NumberOfConfigurations, T);
 			}
@@ -484,7 +706,7 @@ void SADF_AnalyzeGraph(SADF_Graph* Graph, CPairs &analyze, ostream &out) {
 			
 				CTimer T;
 				startTimer(&T);
-				NumberOfConfigurations = SADF_Analyse_LongRunInterFiringLatency(Graph, SADF_DETECTOR, i, Average, Variance);
+				NumberOfConfigurations = SADF_Analyse_LongRunInterFiringLatency(Graph, SADF_DETECTOR, i, Average, Variance, settings.tolerance, settings.nrThreads);
 				stopTimer(&T);
 				SADF_PrintPerformanceResultForProcess(out, Graph->getDetector(i)->getName(), SADF_DETECTOR, 1 / Average, NumberOfConfigurations, T);
 			}
@@ -495,7 +717,7 @@ void SADF_AnalyzeGraph(SADF_Graph* Graph, CPairs &analyze, ostream &out) {
 
 			CTimer T;
 			startTimer(&T);
-			NumberOfConfigurations = SADF_Analyse_LongRunInterFiringLatency(Graph, ProcessType, ProcessID, Average, Variance);
+			NumberOfConfigurations = SADF_Analyse_LongRunInterFiringLatency(Graph, ProcessType, ProcessID, Average, Variance, settings.tolerance, settings.nrThreads);
 			stopTimer(&T);
 			SADF_PrintPerformanceResultForProcess(out, Process->getName(), ProcessType, 1 / Average, NumberOfConfigurations, T);
 		}
@@ -672,7 +894,7 @@ void SADF_AnalyzeGraph(SADF_Graph* Graph, CPairs &analyze, ostream &out) {
 		startTimer(&T);
 	
 		if (MetricType == "periodic")
-			NumberOfConfigurations = SADF_Analyse_PeriodicDeadlineMissProbability(Graph, ProcessType, ProcessID, Deadline, Probability);
+			NumberOfConfigurations = SADF_Analyse_PeriodicDeadlineMissProbability(Graph, ProcessType, ProcessID, Deadline, Probability, settings.tolerance, settings.nrThreads);
 		else
 			NumberOfConfigurations = SADF_Analyse_ResponseDeadlineMissProbability(Graph, ProcessType, ProcessID, Deadline, Probability);			
 
@@ -735,7 +957,7 @@ void SADF_AnalyzeGraph(SADF_Graph* Graph, CPairs &analyze, ostream &out) {
 				if (MetricType == "maximum")
 					NumberOfConfigurations = SADF_Analyse_MaximumBufferOccupancy(Graph, SADF_DATA_CHANNEL, i, Maximum);
 				else
-					NumberOfConfigurations = SADF_Analyse_LongRunBufferOccupancy(Graph, SADF_DATA_CHANNEL, i, Average, Variance);
+					NumberOfConfigurations = SADF_Analyse_LongRunBufferOccupancy(Graph, SADF_DATA_CHANNEL, i, Average, Variance, settings.tolerance, settings.nrThreads);
 				
 				stopTimer(&T);
 
@@ -755,7 +977,7 @@ void SADF_AnalyzeGraph(SADF_Graph* Graph, CPairs &analyze, ostream &out) {
 				if (MetricType == "maximum")
 					NumberOfConfigurations = SADF_Analyse_MaximumBufferOccupancy(Graph, SADF_CONTROL_CHANNEL, i, Maximum);
 				else
-					NumberOfConfigurations = SADF_Analyse_LongRunBufferOccupancy(Graph, SADF_CONTROL_CHANNEL, i, Average, Variance);
+					NumberOfConfigurations = SADF_Analyse_LongRunBufferOccupancy(Graph, SADF_CONTROL_CHANNEL, i, Average, Variance, settings.tolerance, settings.nrThreads);
 
 				stopTimer(&T);
 
@@ -782,7 +1004,7 @@ void SADF_AnalyzeGraph(SADF_Graph* Graph, CPairs &analyze, ostream &out) {
 			if (MetricType == "maximum")
 				NumberOfConfigurations = SADF_Analyse_MaximumBufferOccupancy(Graph, ChannelType, ChannelID, Maximum);
 			else
-				NumberOfConfigurations = SADF_Analyse_LongRunBufferOccupancy(Graph, ChannelType, ChannelID, Average, Variance);
+				NumberOfConfigurations = SADF_Analyse_LongRunBufferOccupancy(Graph, ChannelType, ChannelID, Average, Variance, settings.tolerance, settings.nrThreads);
 			
 			stopTimer(&T);
 
@@ -48,6 +48,10 @@
 // Maximum Cycle Mean
 #include "mcm/mcm.h"
 
+// State space
+#include "statespace/flat_graph.h"
+#include "statespace/state.h"
+
 // Throughput
 #include "throughput/throughput.h"
 
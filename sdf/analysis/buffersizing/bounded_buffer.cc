@@ -245,6 +245,30 @@ void SDFstateSpaceBindingAwareBufferAnalysis::TransitionSystem::State
     }
 }
 
+/**
+ * pack ()
+ * The function writes the state into the compact state s. The global clock is
+ * stored at word offset zero.
+ */
+void SDFstateSpaceBindingAwareBufferAnalysis::TransitionSystem::State::pack(
+        SDFcompactState &s) const
+{
+    s.clear();
+    s.pushLong(glbClk);
+
+    for (uint i = 0; i < ch.size(); i++)
+        s.pushWord(ch[i]);
+
+    for (uint i = 0; i < actClk.size(); i++)
+        s.pushClocks(actClk[i]);
+
+    for (uint i = 0; i < schedulePos.size(); i++)
+    {
+        s.pushWord(schedulePos[i]);
+        s.pushWord(tdmaPos[i]);
+    }
+}
+
 /******************************************************************************
  * Transition system
  *****************************************************************************/
@@ -317,27 +341,9 @@ void SDFstateSpaceBindingAwareBufferAnalysis::TransitionSystem
 bool SDFstateSpaceBindingAwareBufferAnalysis::TransitionSystem::storeState(
         State &s, StatesIter &pos)
 {
-    // Find state in the list of stored states
-    for (StatesIter iter = storedStates.begin();
-            iter != storedStates.end(); iter++)
-    {
-        State &x = *iter;
-        
-        // State s at position iter in the list?
-        if (x == s)
-        {
-            pos = iter;
-            return false;
-        }
-    }
-    
-    // State not found, store it at the end of the list
-    storedStates.push_back(s);
-    
-    // Added state to the end of the list
-    pos = storedStates.end();
+    s.pack(encodedState);
     
-    return true;
+    return storedStates.store(encodedState, pos);
 }
 
 /**  
@@ -352,16 +358,14 @@ TDtime SDFstateSpaceBindingAwareBufferAnalysis::TransitionSystem
 	TDtime time = 0;  
 
 	// Check all state from stack till cycle complete  
-	for (StatesIter iter = cycleIter; iter != storedStates.end(); iter++)
+	for (StatesIter iter = cycleIter; iter != storedStates.size(); iter++)
     {
-        State &s = *iter;
-
         // Number of states in cycle is equal to number of iterations 
         // in the period
         nr_fire++;
 
 	    // Time between previous state  
-	    time += s.glbClk;
+	    time += storedStates.getLong(iter, 0);
 	}
 
 	return (TDtime)(nr_fire)/(time);  
@@ -40,6 +40,7 @@
 
 #include "storage_distribution.h"
 #include "../../resource_allocation/binding_aware_sdfg/binding_aware_sdfg.h"
+#include "../statespace/state.h"
 
 /**
  * Throughput / storage-space trade-off exploration
@@ -108,6 +109,9 @@ private:
             // Clear state
             void clear();
 
+            // Encode the state into a compact state
+            void pack(SDFcompactState &s) const;
+
             // Output state
             void print(ostream &out);
 
@@ -119,9 +123,8 @@ private:
             vector< SDFtime > tdmaPos;
         };
 
-        // Sequence of states in transition system        
-        typedef list<State>      States;
-        typedef States::iterator StatesIter;
+        // Position of a state in the transition system
+        typedef SDFstatePos StatesIter;
 
         // Constructor
         TransitionSystem(BindingAwareSDFG *bg) {
@@ -180,8 +183,11 @@ private:
         State currentState; 
         State previousState;
 
-        // List of visited states that are stored
-        States storedStates;
+        // Visited states that are stored
+        SDFstateStore storedStates;
+
+        // Encoding of the state which is being stored
+        SDFcompactState encodedState;
     };
     
     // Bounds on the search space
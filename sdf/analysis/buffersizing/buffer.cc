@@ -220,6 +220,27 @@ bool SDFstateSpaceBufferAnalysis::TransitionSystem::State::operator==(
     return true;
 }
 
+/**
+ * pack ()
+ * The function writes the state into the compact state s. The global clock is
+ * stored at word offset zero.
+ */
+void SDFstateSpaceBufferAnalysis::TransitionSystem::State::pack(
+        SDFcompactState &s) const
+{
+    s.clear();
+    s.pushLong(glbClk);
+
+    for (uint i = 0; i < ch.size(); i++)
+    {
+        s.pushWord(ch[i]);
+        s.pushWord(sp[i]);
+    }
+
+    for (uint i = 0; i < actClk.size(); i++)
+        s.pushClocks(actClk[i]);
+}
+
 /******************************************************************************
  * Transition system
  *****************************************************************************/
@@ -231,26 +252,22 @@ bool SDFstateSpaceBufferAnalysis::TransitionSystem::State::operator==(
  */
 void SDFstateSpaceBufferAnalysis::TransitionSystem::initOutputActor()
 {
-    RepetitionVector repVec;
     int min = INT_MAX;
     SDFactor *a = NULL;
 
-    // Compute repetition vector
-    repVec = computeRepetitionVector(g);
-    
     // Select actor with lowest entry in repetition vector as output actor
     for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
     {
-        if (repVec[(*iter)->getId()] < min)
+        if (flatGraph.repetitions((*iter)->getId()) < min)
         {
             a = *iter;
-            min = repVec[a->getId()];
+            min = flatGraph.repetitions(a->getId());
         }
     }
     
     // Set output actor and its repetition vector count
-    outputActor = a;
-    outputActorRepCnt = repVec[outputActor->getId()];
+    outputActor = a->getId();
+    outputActorRepCnt = flatGraph.repetitions(outputActor);
 }
 
 /**
@@ -264,27 +281,9 @@ void SDFstateSpaceBufferAnalysis::TransitionSystem::initOutputActor()
 bool SDFstateSpaceBufferAnalysis::TransitionSystem::storeState(State &s,
         StatesIter &pos)
 {
-    // Find state in the list of stored states
-    for (StatesIter iter = storedStates.begin();
-            iter != storedStates.end(); iter++)
-    {
-        State &x = *iter;
-        
-        // State s at position iter in the list?
-        if (x == s)
-        {
-            pos = iter;
-            return false;
-        }
-    }
+    s.pack(encodedState);
     
-    // State not found, store it at the end of the list
-    storedStates.push_back(s);
-    
-    // Added state to the end of the list
-    pos = storedStates.end();
-    
-    return true;
+    return storedStates.store(encodedState, pos);
 }
 
 /**  
@@ -299,16 +298,14 @@ TDtime SDFstateSpaceBufferAnalysis::TransitionSystem::computeThroughput(
 	TDtime time = 0;  
 
 	// Check all state from stack till cycle complete  
-	for (StatesIter iter = cycleIter; iter != storedStates.end(); iter++)
+	for (StatesIter iter = cycleIter; iter != storedStates.size(); iter++)
     {
-        State &s = *iter;
-
         // Number of states in cycle is equal to number of iterations 
         // in the period
         nr_fire++;
 
 	    // Time between previous state  
-	    time += s.glbClk;
+	    time += storedStates.getLong(iter, 0);
 	}
 
 	return (TDtime)(nr_fire)/(time);  
@@ -348,15 +345,13 @@ void SDFstateSpaceBufferAnalysis::TransitionSystem::dfsVisitDependencies(uint a,
                 {
                     // All channels from d to c in the SDFG have 
                     // storage dependency
-                    for (SDFchannelsIter iter = g->channelsBegin();
-                            iter != g->channelsEnd(); iter++)
+                    for (uint ch = 0; ch < flatGraph.nrChannels(); ch++)
                     {
-                        SDFchannel *ch = *iter;
-                        CId srcId = ch->getSrcActor()->getId();
-                        CId dstId = ch->getDstActor()->getId();
-                        
-                        if (dstId == d && srcId == c)
-                            dep[ch->getId()] = true;
+                        if (flatGraph.dstActor(ch) == d 
+                                && flatGraph.srcActor(ch) == c)
+                        {
+                            dep[ch] = true;
+                        }
                     }
 
                     // Next
@@ -440,29 +435,20 @@ void SDFstateSpaceBufferAnalysis::TransitionSystem::findStorageDependencies(
  * s. Else it returns false.
  */
 bool SDFstateSpaceBufferAnalysis::TransitionSystem::actorReadyToFire(
-        SDFactor *a)
+        const CId a)
 {
     // Check all input ports for tokens
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    for (uint p = flatGraph.inBegin(a); p < flatGraph.inEnd(a); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-        
-        // Actor is destination of the channel?
-        if (p->getType() == SDFport::In)
-        {
-            if (!CH_TOKENS(c->getId(), p->getRate()))
-            {
-                return false;
-            }    
-        }
-        else
-        {
-            if (!CH_SPACE(c->getId(), p->getRate()))
-            {
-                return false;
-            }    
-        }
+        if (!CH_TOKENS(flatGraph.inChannel(p), flatGraph.inRate(p)))
+            return false;
+    }
+
+    // Check all output ports for space
+    for (uint p = flatGraph.outBegin(a); p < flatGraph.outEnd(a); p++)
+    {
+        if (!CH_SPACE(flatGraph.outChannel(p), flatGraph.outRate(p)))
+            return false;
     }
 
     return true;
@@ -475,27 +461,22 @@ bool SDFstateSpaceBufferAnalysis::TransitionSystem::actorReadyToFire(
  * position.
  */
 void SDFstateSpaceBufferAnalysis::TransitionSystem::startActorFiring(
-        TimedSDFactor *a)
+        const CId a)
 {
-    // Consume tokens from inputs and space for output tokens
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    // Consume tokens from inputs
+    for (uint p = flatGraph.inBegin(a); p < flatGraph.inEnd(a); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-        
-        // Actor is destination of the channel?
-        if (p->getType() == SDFport::In)
-        {
-            CONSUME(c->getId(), p->getRate());
-        }
-        else
-        {
-            CONSUME_SP(c->getId(), p->getRate());
-        }
+        CONSUME(flatGraph.inChannel(p), flatGraph.inRate(p));
+    }
+
+    // Consume space for output tokens
+    for (uint p = flatGraph.outBegin(a); p < flatGraph.outEnd(a); p++)
+    {
+        CONSUME_SP(flatGraph.outChannel(p), flatGraph.outRate(p));
     }
 
     // Add actor firing to the list of active firings of this actor
-    currentState.actClk[a->getId()].push_back(a->getExecutionTime());
+    currentState.actClk[a].push_back(flatGraph.executionTime(a));
 }
 
 /**
@@ -503,13 +484,14 @@ void SDFstateSpaceBufferAnalysis::TransitionSystem::startActorFiring(
  * The function returns true when the actor is ready to end its firing. Else
  * the function returns false.
  */
-bool SDFstateSpaceBufferAnalysis::TransitionSystem::actorReadyToEnd(SDFactor *a)
+bool SDFstateSpaceBufferAnalysis::TransitionSystem::actorReadyToEnd(
+        const CId a)
 {
-    if (currentState.actClk[a->getId()].empty())
+    if (currentState.actClk[a].empty())
         return false;
     
     // First actor firing in sorted list has execution time left?
-    if (currentState.actClk[a->getId()].front() != 0)
+    if (currentState.actClk[a].front() != 0)
         return false;
 
     return true;
@@ -520,26 +502,23 @@ bool SDFstateSpaceBufferAnalysis::TransitionSystem::actorReadyToEnd(SDFactor *a)
  * Produce tokens on all output channels and remove the actor firing from the
  * list of active firings.
  */
-void SDFstateSpaceBufferAnalysis::TransitionSystem::endActorFiring(SDFactor *a)
+void SDFstateSpaceBufferAnalysis::TransitionSystem::endActorFiring(
+        const CId a)
 {
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    // Produce tokens on outputs
+    for (uint p = flatGraph.outBegin(a); p < flatGraph.outEnd(a); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-        
-        // Actor is source of the channel?
-        if (p->getType() == SDFport::Out)
-        {
-            PRODUCE(c->getId(), p->getRate());
-        }
-        else
-        {
-            PRODUCE_SP(c->getId(), p->getRate());
-        }
+        PRODUCE(flatGraph.outChannel(p), flatGraph.outRate(p));
+    }
+
+    // Release space of consumed tokens
+    for (uint p = flatGraph.inBegin(a); p < flatGraph.inEnd(a); p++)
+    {
+        PRODUCE_SP(flatGraph.inChannel(p), flatGraph.inRate(p));
     }
 
     // Remove the firing from the list of active actor firings
-    currentState.actClk[a->getId()].pop_front();
+    currentState.actClk[a].pop_front();
 }
 
 /**
@@ -598,34 +577,28 @@ SDFtime SDFstateSpaceBufferAnalysis::TransitionSystem::clockStep()
  * graph.
  */
 void SDFstateSpaceBufferAnalysis::TransitionSystem::findCausalDependencies(
-        SDFactor *a, bool **abstractDepGraph)
+        const CId a, bool **abstractDepGraph)
 {
-    // Check all input ports for tokens and output ports for space
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    // Check all input ports for tokens
+    for (uint p = flatGraph.inBegin(a); p < flatGraph.inEnd(a); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-        SDFactor *srcActor = c->getSrcActor();
-        SDFactor *dstActor = c->getDstActor();
-        
-        // Actor is destination of the channel?
-        if (p->getType() == SDFport::In)
+        // Not enough tokens in the previous state?
+        if (!CH_TOKENS_PREV(flatGraph.inChannel(p), flatGraph.inRate(p)))
         {
-            // Not enough tokens in the previous state?
-            if (!CH_TOKENS_PREV(c->getId(), p->getRate()))
-            {
-                abstractDepGraph[dstActor->getId()][srcActor->getId()] = true;
-            }    
-        }
-        else
+            abstractDepGraph[a][flatGraph.srcActor(flatGraph.inChannel(p))]
+                                                                    = true;
+        }    
+    }
+
+    // Check all output ports for space
+    for (uint p = flatGraph.outBegin(a); p < flatGraph.outEnd(a); p++)
+    {
+        // Not enough space in the previous state?
+        if (!CH_SPACE_PREV(flatGraph.outChannel(p), flatGraph.outRate(p)))
         {
-            // Not enough space in the previous state?
-            if (!CH_SPACE_PREV(c->getId(), p->getRate()))
-            {
-                abstractDepGraph[srcActor->getId()][dstActor->getId()] = true;
-            }
+            abstractDepGraph[a][flatGraph.dstActor(flatGraph.outChannel(p))]
+                                                                    = true;
         }
-        
     }
 }
 
@@ -662,13 +635,11 @@ void SDFstateSpaceBufferAnalysis::TransitionSystem::analyzePeriodicPhase(
     repCnt = -1;
 
     // Complete the remaining actor firings
-    for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
+    for (CId a = 0; a < flatGraph.nrActors(); a++)
     {
-        SDFactor *a = *iter;
-        
         while (actorReadyToEnd(a))  
         {
-            if (a->getId() == outputActor->getId())
+            if (a == outputActor)
             {
                 repCnt++;
                 if (repCnt == outputActorRepCnt)
@@ -686,11 +657,8 @@ void SDFstateSpaceBufferAnalysis::TransitionSystem::analyzePeriodicPhase(
     while (true)
     {
         // Start actor firings
-        for (SDFactorsIter iter = g->actorsBegin();
-                iter != g->actorsEnd(); iter++)
+        for (CId a = 0; a < flatGraph.nrActors(); a++)
         {
-            TimedSDFactor *a = (TimedSDFactor*)(*iter);
-
             // Ready to fire actor a?
             while (actorReadyToFire(a))
             {
@@ -713,14 +681,11 @@ void SDFstateSpaceBufferAnalysis::TransitionSystem::analyzePeriodicPhase(
         }
 
         // Finish actor firings  
-        for (SDFactorsIter iter = g->actorsBegin();
-                iter != g->actorsEnd(); iter++)
+        for (CId a = 0; a < flatGraph.nrActors(); a++)
         {
-            SDFactor *a = *iter;
-
             while (actorReadyToEnd(a))  
             {
-                if (outputActor->getId() == a->getId())
+                if (outputActor == a)
                 {
                     repCnt++;
                     if (repCnt == outputActorRepCnt)  
@@ -771,23 +736,21 @@ void SDFstateSpaceBufferAnalysis::TransitionSystem::analyzeDeadlock(
     }
 
     // Check number of tokens on every channel in the graph
-    for (SDFchannelsIter iter = g->channelsBegin();
-            iter != g->channelsEnd(); iter++)
+    for (uint c = 0; c < flatGraph.nrChannels(); c++)
     {
-        SDFchannel *c = *iter;
-        SDFactor *srcActor = c->getSrcActor();
-        SDFactor *dstActor = c->getDstActor();
+        CId srcActor = flatGraph.srcActor(c);
+        CId dstActor = flatGraph.dstActor(c);
         
         // Insufficient tokens to fire destination actor
-        if (!CH_TOKENS(c->getId(), c->getDstPort()->getRate()))
+        if (!CH_TOKENS(c, flatGraph.dstRate(c)))
         {
-            abstractDepGraph[dstActor->getId()][srcActor->getId()] = true;
+            abstractDepGraph[dstActor][srcActor] = true;
         }
 
         // Insufficient space to fire source actor
-        if (!CH_SPACE(c->getId(), c->getSrcPort()->getRate()))
+        if (!CH_SPACE(c, flatGraph.srcRate(c)))
         {
-            abstractDepGraph[srcActor->getId()][dstActor->getId()] = true;
+            abstractDepGraph[srcActor][dstActor] = true;
         }
     }
 
@@ -822,20 +785,17 @@ TDtime SDFstateSpaceBufferAnalysis::TransitionSystem::execSDFgraph(
     previousState.clear();  
 
     // Initial tokens and space
-    for (SDFchannelsIter iter = g->channelsBegin();
-            iter != g->channelsEnd(); iter++)
+    for (uint c = 0; c < flatGraph.nrChannels(); c++)
     {
-        SDFchannel *c = *iter;
-
         // Not enough space for initial tokens?
-        if (sp[c->getId()] < c->getInitialTokens())
+        if (sp[c] < flatGraph.initialTokens(c))
         {
-            dep[c->getId()] = true;
+            dep[c] = true;
             return 0;
         }
 
-        CH(c->getId()) = c->getInitialTokens();
-        SP(c->getId()) = sp[c->getId()] - c->getInitialTokens();
+        CH(c) = flatGraph.initialTokens(c);
+        SP(c) = sp[c] - flatGraph.initialTokens(c);
     }
 
     // Fire the actors  
@@ -849,14 +809,11 @@ TDtime SDFstateSpaceBufferAnalysis::TransitionSystem::execSDFgraph(
         }
 
         // Finish actor firings  
-        for (SDFactorsIter iter = g->actorsBegin();
-                iter != g->actorsEnd(); iter++)
+        for (CId a = 0; a < flatGraph.nrActors(); a++)
         {
-            SDFactor *a = *iter;
-            
             while (actorReadyToEnd(a))  
             {
-                if (outputActor->getId() == a->getId())
+                if (outputActor == a)
                 {
                     repCnt++;
                     if (repCnt == outputActorRepCnt)  
@@ -880,11 +837,8 @@ TDtime SDFstateSpaceBufferAnalysis::TransitionSystem::execSDFgraph(
         }
 
         // Start actor firings  
-        for (SDFactorsIter iter = g->actorsBegin();
-                iter != g->actorsEnd(); iter++)
+        for (CId a = 0; a < flatGraph.nrActors(); a++)
         {
-            TimedSDFactor *a = (TimedSDFactor*)(*iter);
-            
             // Ready to fire actor a?
             while (actorReadyToFire(a))
             {
@@ -942,17 +896,17 @@ void SDFstateSpaceBufferAnalysis::deleteStorageDistribution(
 /**
  * execStorageDistribution ()
  * Compute throughput and storage dependencies of the given storage
- * distribution.
+ * distribution using the transition system ts.
  */
 void SDFstateSpaceBufferAnalysis::execStorageDistribution(
-        StorageDistribution *d)
+        StorageDistribution *d, TransitionSystem *ts)
 {
     // Initialize blocking channels
     for (uint c = 0; c < g->nrChannels(); c++)
         d->dep[c] = false;
 
     // Execute the SDF graph to find its output interval
-    d->thr = transitionSystem->execSDFgraph(d->sp, d->dep);
+    d->thr = ts->execSDFgraph(d->sp, d->dep);
 
     //cerr << d->sz << " " << d->thr << endl;
     //for (uint c = 0; c < g->nrChannels(); c++)
@@ -960,6 +914,21 @@ void SDFstateSpaceBufferAnalysis::execStorageDistribution(
     //cerr << endl;
 }
 
+/**
+ * execStorageDistributionJob ()
+ * Execute the storage distribution with the given index in the list of
+ * distributions which are executed in parallel. Every thread uses its own
+ * transition system.
+ */
+void SDFstateSpaceBufferAnalysis::execStorageDistributionJob(void *arg,
+        const CSize job, const uint thread)
+{
+    SDFstateSpaceBufferAnalysis *b = (SDFstateSpaceBufferAnalysis*)arg;
+    
+    b->execStorageDistribution(b->execDistributions[job],
+            b->transitionSystems[thread]);
+}
+
 /**
  * minimizeMinStorageDistributions ()
  * The function removes all storage distributions within the supplied
@@ -1042,9 +1011,11 @@ bool SDFstateSpaceBufferAnalysis::addStorageDistributionToChecklist(
         StorageDistribution *d)
 {
     StorageDistributionSet *ds, *dsNew;
-    StorageDistribution *di;
-    bool equalDistr;
     
+    // Distribution already seen during the exploration?
+    if (!distributionMemo.insert(d->sp))
+        return false;
+
     // First distribution ever added?
     if (minStorageDistributions == NULL)
     {
@@ -1075,28 +1046,6 @@ bool SDFstateSpaceBufferAnalysis::addStorageDistributionToChecklist(
     // Set of storage distribution with same size as d exists?
     if (ds->sz == d->sz)
     {
-
-        // Check that distribution d does not exist in the set
-        di = ds->distributions;
-        while (di != NULL)
-        {
-            equalDistr = true;
-
-            // All channels have same storage space allocation?
-            for (uint c = 0; equalDistr && c < g->nrChannels(); c++)
-            {
-                if (di->sp[c] != d->sp[c])
-                    equalDistr = false;
-            }
-
-            // Found equal distribution
-            if (equalDistr)
-                return false;
-
-            // Next
-            di = di->next;
-        }
-
         // Distribution 'd' not yet in the set, so let's add it
         ds->distributions->prev = d;
         d->next = ds->distributions;
@@ -1142,21 +1091,17 @@ bool SDFstateSpaceBufferAnalysis::addStorageDistributionToChecklist(
 }
 
 /**
- * exploreStorageDistribution ()
- * The function computes the throughput of the storage distribution
- * 'd' and adds new storage distributions to the list of distributions
- * which must be checked based on the storage dependencies found in d.
- * The function also updates the maximal throughput of the set of
- * storage distributions when needed.
+ * expandStorageDistribution ()
+ * The function adds new storage distributions to the list of distributions
+ * which must be checked based on the storage dependencies found in the
+ * executed storage distribution 'd'. The function also updates the maximal
+ * throughput of the set of storage distributions when needed.
  */
-void SDFstateSpaceBufferAnalysis::exploreStorageDistribution(
+void SDFstateSpaceBufferAnalysis::expandStorageDistribution(
         StorageDistributionSet *ds, StorageDistribution *d)
 {
     StorageDistribution *dNew;
     
-    // Compute throughput and storage dependencies
-    execStorageDistribution(d);
-    
     // Throughput of d larger then current maximum of the set
     if (d->thr > ds->thr)
         ds->thr = d->thr;
@@ -1206,16 +1151,22 @@ void SDFstateSpaceBufferAnalysis::exploreStorageDistributionSet(
 {
     StorageDistribution *d;
 
-    // Explore all storage distributions contained in the set    
-    d = ds->distributions;
-    while (d != NULL)
-    {
-        // Explore distribution d
-        exploreStorageDistribution(ds, d);
-        
-        // Next
-        d = d->next;
-    }
+    // All distributions in the set have the same size. New distributions
+    // are larger, so the distributions in the set can be executed
+    // independently of each other. Every distribution enters the set only
+    // once (see addStorageDistributionToChecklist).
+    execDistributions.clear();
+    for (d = ds->distributions; d != NULL; d = d->next)
+        execDistributions.push_back(d);
+    
+    // Execute the distributions (on one or more threads)
+    runParallelJobs(execStorageDistributionJob, this,
+            execDistributions.size(), transitionSystems.size());
+    
+    // Add new storage distributions in the order of the set, such that
+    // the result does not depend on the order of completion of the jobs
+    for (d = ds->distributions; d != NULL; d = d->next)
+        expandStorageDistribution(ds, d);
     
     // Remove all non-minimal storage distributions from the set
     minimizeStorageDistributionsSet(ds);
@@ -1335,6 +1286,33 @@ void SDFstateSpaceBufferAnalysis::findMinimalStorageDistributions(
     }
 }
 
+/**
+ * createTransitionSystems ()
+ * The function creates a transition system for every thread that is used to
+ * explore the storage distributions.
+ */
+void SDFstateSpaceBufferAnalysis::createTransitionSystems()
+{
+    uint n = (nrThreads < 1 ? 1 : nrThreads);
+    
+    deleteTransitionSystems();
+    
+    for (uint i = 0; i < n; i++)
+        transitionSystems.push_back(new TransitionSystem(g));
+}
+
+/**
+ * deleteTransitionSystems ()
+ * The function deletes all transition systems.
+ */
+void SDFstateSpaceBufferAnalysis::deleteTransitionSystems()
+{
+    for (uint i = 0; i < transitionSystems.size(); i++)
+        delete transitionSystems[i];
+    
+    transitionSystems.clear();
+}
+
 /**
  * analyze ()
  * Analyze the trade-offs between storage distributions and throughput (using
@@ -1354,8 +1332,11 @@ StorageDistributionSet *SDFstateSpaceBufferAnalysis::analyze(
     // Initialize bounds on the search space
     initBoundsSearchSpace(g);
 
-    // Create a transition system
-    transitionSystem = new TransitionSystem(g);
+    // Create the transition systems
+    createTransitionSystems();
+
+    // No storage distributions seen so far
+    distributionMemo.init(g->nrChannels());
 
     // Search the space
     findMinimalStorageDistributions(thrBound);
@@ -1363,7 +1344,7 @@ StorageDistributionSet *SDFstateSpaceBufferAnalysis::analyze(
     // Cleanup
     delete [] minSz;
     delete [] minSzStep;
-    delete transitionSystem;
+    deleteTransitionSystems();
     
     return minStorageDistributions;
 }
@@ -1385,9 +1366,12 @@ void SDFstateSpaceBufferAnalysis::initSearch(TimedSDFgraph *gr)
     // Initialize bounds on the search space
     initBoundsSearchSpace(g);
 
-    // Create a transition system
-    transitionSystem = new TransitionSystem(g);
+    // Create the transition systems
+    createTransitionSystems();
     
+    // No storage distributions seen so far
+    distributionMemo.init(g->nrChannels());
+
     // Construct storage distribution with lower bound storage space
     d = newStorageDistribution();
     d->thr = 0;
@@ -40,6 +40,8 @@
 
 #include "storage_distribution.h"
 #include "../../base/timed/graph.h"
+#include "../statespace/state.h"
+#include "../statespace/flat_graph.h"
 
 /**
  * Throughput / storage-space trade-off exploration
@@ -52,10 +54,10 @@ class SDFstateSpaceBufferAnalysis
 {
 public:
     // Constructor
-    SDFstateSpaceBufferAnalysis() {};
+    SDFstateSpaceBufferAnalysis(const uint nrThr = 1) { nrThreads = nrThr; };
     
     // Destructor
-    ~SDFstateSpaceBufferAnalysis() {};
+    ~SDFstateSpaceBufferAnalysis() { deleteTransitionSystems(); };
     
     // Analyze throughput/storage-space trade-off space
     StorageDistributionSet *analyze(TimedSDFgraph *gr,
@@ -65,6 +67,10 @@ public:
     void initSearch(TimedSDFgraph *gr);
     StorageDistributionSet *findNextStorageDistributionSet();
     
+    // Number of threads used to explore storage distributions
+    uint getNrThreads() const { return nrThreads; };
+    void setNrThreads(const uint nrThr) { nrThreads = nrThr; };
+
 private:
 
     /***************************************************************************
@@ -102,6 +108,9 @@ private:
             // Clear state
             void clear();
 
+            // Encode the state into a compact state
+            void pack(SDFcompactState &s) const;
+
             // Output state
             void print(ostream &out);
 
@@ -112,13 +121,13 @@ private:
             unsigned long glbClk;
         };
 
-        // Sequence of states in transition system        
-        typedef list<State>      States;
-        typedef States::iterator StatesIter;
+        // Position of a state in the transition system
+        typedef SDFstatePos StatesIter;
 
         // Constructor
         TransitionSystem(TimedSDFgraph *gr) {
             g = gr;
+            flatGraph.compile(g);
             initOutputActor();   
         };
         
@@ -139,7 +148,7 @@ private:
         void dfsVisitDependencies(uint a, int *color, int *pi,
                 bool **abstractDepGraph, bool *dep);
         void findStorageDependencies(bool **abstractDepGraph, bool *dep);
-        void findCausalDependencies(SDFactor *a, bool **abstractDepGraph);
+        void findCausalDependencies(const CId a, bool **abstractDepGraph);
         void analyzePeriodicPhase(const TBufSize *sp, bool *dep);
         void analyzeDeadlock(const TBufSize *sp, bool *dep);
 
@@ -147,10 +156,10 @@ private:
         TDtime computeThroughput(const StatesIter cycleIter);
 
         // State transitions
-        bool actorReadyToFire(SDFactor *a);
-        void startActorFiring(TimedSDFactor *a);
-        bool actorReadyToEnd(SDFactor *a);
-        void endActorFiring(SDFactor *a);
+        bool actorReadyToFire(const CId a);
+        void startActorFiring(const CId a);
+        bool actorReadyToEnd(const CId a);
+        void endActorFiring(const CId a);
         SDFtime clockStep();
 
         // Output actor
@@ -158,15 +167,21 @@ private:
 
         // SDF graph and output actor
         TimedSDFgraph *g;
-        SDFactor *outputActor;
+        CId outputActor;
         TCnt outputActorRepCnt;
+
+        // Flat execution model of the graph
+        SDFflatGraph flatGraph;
         
         // Current and previous state
         State currentState; 
         State previousState;
 
-        // List of visited states that are stored
-        States storedStates;
+        // Visited states that are stored
+        SDFstateStore storedStates;
+
+        // Encoding of the state which is being stored
+        SDFcompactState encodedState;
     };
     
     // Bounds on the search space
@@ -179,10 +194,13 @@ private:
     // Storage distributions
     StorageDistribution *newStorageDistribution();
     void deleteStorageDistribution(StorageDistribution *d);
-    void execStorageDistribution(StorageDistribution *d);
+    void execStorageDistribution(StorageDistribution *d,
+            TransitionSystem *ts);
+    static void execStorageDistributionJob(void *arg, const CSize job,
+            const uint thread);
     void minimizeStorageDistributionsSet(StorageDistributionSet *ds);
     bool addStorageDistributionToChecklist(StorageDistribution *d);
-    void exploreStorageDistribution(StorageDistributionSet *ds,
+    void expandStorageDistribution(StorageDistributionSet *ds,
             StorageDistribution *d);
     void exploreStorageDistributionSet(StorageDistributionSet *ds);
     void findMinimalStorageDistributions(const double thrBound);
@@ -190,8 +208,17 @@ private:
     // SDF graph
     TimedSDFgraph *g;
     
-    // Transition system
-    TransitionSystem *transitionSystem;
+    // Transition systems (one per thread)
+    vector<TransitionSystem*> transitionSystems;
+    void createTransitionSystems();
+    void deleteTransitionSystems();
+    uint nrThreads;
+    
+    // Storage distributions executed in parallel
+    vector<StorageDistribution*> execDistributions;
+    
+    // Storage distributions seen during the exploration
+    StorageDistributionMemo distributionMemo;
     
     // Storage distributions
     StorageDistributionSet *minStorageDistributions;
@@ -39,6 +39,7 @@
 
 #include "storage_distribution.h"
 #include "../../base/timed/graph.h"
+#include "../statespace/state.h"
 
 /**
  * Throughput / storage-space trade-off exploration for Ning and Gao's buffer 
@@ -93,6 +94,9 @@ private:
             // Clear state
             void clear();
 
+            // Encode the state into a compact state
+            void pack(SDFcompactState &s) const;
+
             // Output state
             void print(ostream &out);
 
@@ -103,9 +107,8 @@ private:
             unsigned long glbClk;
         };
 
-        // Sequence of states in transition system        
-        typedef list<State>      States;
-        typedef States::iterator StatesIter;
+        // Position of a state in the transition system
+        typedef SDFstatePos StatesIter;
 
         // Constructor
         TransitionSystem(TimedSDFgraph *gr) {
@@ -158,8 +161,11 @@ private:
         State currentState; 
         State previousState;
 
-        // List of visited states that are stored
-        States storedStates;
+        // Visited states that are stored
+        SDFstateStore storedStates;
+
+        // Encoding of the state which is being stored
+        SDFcompactState encodedState;
     };
     
     // Bounds on the search space
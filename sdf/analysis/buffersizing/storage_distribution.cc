@@ -0,0 +1,149 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   storage_distribution.cc
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 17, 2026
+ *
+ *  Function        :   Memo table of storage distributions
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+#include "storage_distribution.h"
+
+// Initial number of slots in the index (power of two)
+#define MEMO_INDEX_INIT_SIZE    256
+
+/**
+ * init ()
+ * The function removes all entries from the table. The table is prepared for
+ * storage distributions of nrCh channels.
+ */
+void StorageDistributionMemo::init(const uint nrCh)
+{
+    nrChannels = nrCh;
+
+    arena.reset();
+    entries.clear();
+    index.assign(MEMO_INDEX_INIT_SIZE, (TBufSize*)NULL);
+    keys.assign(MEMO_INDEX_INIT_SIZE, 0);
+}
+
+/**
+ * hashKey ()
+ * The function returns a hash key of the storage space sp.
+ */
+unsigned long long StorageDistributionMemo::hashKey(const TBufSize *sp) const
+{
+    unsigned long long key = 14695981039346656037ULL;
+
+    for (uint c = 0; c < nrChannels; c++)
+        key = (key ^ sp[c]) * 1099511628211ULL;
+
+    // Spread the entropy over the low order bits used by the index
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+
+    return key;
+}
+
+/**
+ * findSlot ()
+ * The function returns the slot of the index which contains the storage space
+ * sp or, when sp is not in the table, the free slot at which it must be added.
+ */
+size_t StorageDistributionMemo::findSlot(const TBufSize *sp,
+        const unsigned long long key) const
+{
+    size_t mask = index.size() - 1;
+    size_t i;
+
+    for (i = key & mask; index[i] != NULL; i = (i + 1) & mask)
+    {
+        if (keys[i] == key && memcmp(index[i], sp,
+                    nrChannels * sizeof(TBufSize)) == 0)
+        {
+            break;
+        }
+    }
+
+    return i;
+}
+
+/**
+ * growIndex ()
+ * The function doubles the number of slots in the index and re-inserts all
+ * entries into the enlarged index.
+ */
+void StorageDistributionMemo::growIndex()
+{
+    size_t mask;
+
+    index.assign(2 * index.size(), (TBufSize*)NULL);
+    keys.assign(index.size(), 0);
+    mask = index.size() - 1;
+
+    for (uint e = 0; e < entries.size(); e++)
+    {
+        unsigned long long key = hashKey(entries[e]);
+        size_t i;
+
+        // Linear probing for a free slot
+        for (i = key & mask; index[i] != NULL; i = (i + 1) & mask);
+
+        index[i] = entries[e];
+        keys[i] = key;
+    }
+}
+
+/**
+ * insert ()
+ * The function adds the storage distribution with storage space sp to the
+ * table. When the distribution is already in the table, the function returns
+ * false.
+ */
+bool StorageDistributionMemo::insert(const TBufSize *sp)
+{
+    unsigned long long key = hashKey(sp);
+    size_t i = findSlot(sp, key);
+    TBufSize *e;
+
+    // Distribution already in the table?
+    if (index[i] != NULL)
+        return false;
+
+    // Copy the storage space into the arena
+    e = arena.allocArray<TBufSize>(nrChannels);
+    memcpy(e, sp, nrChannels * sizeof(TBufSize));
+    entries.push_back(e);
+
+    // Add entry to the index
+    index[i] = e;
+    keys[i] = key;
+
+    // Keep the load of the index below one half
+    if (2 * entries.size() > index.size())
+        growIndex();
+
+    return true;
+}
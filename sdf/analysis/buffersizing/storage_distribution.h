@@ -37,6 +37,7 @@
 #define SDF_ANALYSIS_BUFFERSIZING_STORAGE_DISTRIBUTION_H_INCLUDED
 
 #include "../../basic_types.h"
+#include "base/base.h"
 
 /**
  * StorageDistribution
@@ -67,4 +68,54 @@ typedef struct _StorageDistributionSet
     struct _StorageDistributionSet *next;
 } StorageDistributionSet;
 
+/**
+ * StorageDistributionMemo
+ * Table of storage distributions that have been seen during an exploration of
+ * the throughput/storage-space trade-off space. The table is indexed on the
+ * storage space of the channels through an open addressing hash index. The
+ * storage spaces are copied into an arena, so the table does not refer to the
+ * distributions from which it is filled.
+ */
+class StorageDistributionMemo
+{
+public:
+    // Constructor
+    StorageDistributionMemo() { init(0); };
+
+    // Destructor
+    ~StorageDistributionMemo() {};
+
+    // Remove all entries and set number of channels
+    void init(const uint nrCh);
+
+    // Add storage distribution (returns false when already in the table)
+    bool insert(const TBufSize *sp);
+
+    // Number of entries
+    uint size() const { return entries.size(); };
+
+private:
+    // Hash key of a storage space
+    unsigned long long hashKey(const TBufSize *sp) const;
+
+    // Position of the slot of storage space sp in the index
+    size_t findSlot(const TBufSize *sp, const unsigned long long key) const;
+
+    // Enlarge index
+    void growIndex();
+
+    // Number of channels
+    uint nrChannels;
+
+    // Memory in which the storage spaces are placed
+    CArena arena;
+
+    // Storage spaces in order of insertion
+    vector<TBufSize*> entries;
+
+    // Open addressing hash index (NULL marks a free slot)
+    vector<TBufSize*> index;
+    vector<unsigned long long> keys;
+};
+
 #endif
@@ -121,6 +121,24 @@ bool SDFstateSpaceMinimalLatencyAnalysis::TransitionSystem::State::operator==(
     return true;
 }
 
+/**
+ * pack ()
+ * The function writes the state into the compact state s. The global clock is
+ * stored at word offset zero.
+ */
+void SDFstateSpaceMinimalLatencyAnalysis::TransitionSystem::State::pack(
+        SDFcompactState &s) const
+{
+    s.clear();
+    s.pushLong(glbClk);
+
+    for (uint i = 0; i < ch.size(); i++)
+        s.pushWord(ch[i]);
+
+    for (uint i = 0; i < actClk.size(); i++)
+        s.pushClocks(actClk[i]);
+}
+
 /******************************************************************************
  * Transition system
  *****************************************************************************/
@@ -132,26 +150,22 @@ bool SDFstateSpaceMinimalLatencyAnalysis::TransitionSystem::State::operator==(
  */
 void SDFstateSpaceMinimalLatencyAnalysis::TransitionSystem::initOutputActor()
 {
-    RepetitionVector repVec;
     int min = INT_MAX;
     SDFactor *a = NULL;
 
-    // Compute repetition vector
-    repVec = computeRepetitionVector(g);
-    
     // Select actor with lowest entry in repetition vector as output actor
     for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
     {
-        if (repVec[(*iter)->getId()] < min)
+        if (flatGraph.repetitions((*iter)->getId()) < min)
         {
             a = *iter;
-            min = repVec[a->getId()];
+            min = flatGraph.repetitions(a->getId());
         }
     }
     
     // Set output actor and its repetition vector count
     outputActor = a->getId();
-    outputActorRepCnt = repVec[outputActor];
+    outputActorRepCnt = flatGraph.repetitions(outputActor);
 }
 
 /**
@@ -165,27 +179,9 @@ void SDFstateSpaceMinimalLatencyAnalysis::TransitionSystem::initOutputActor()
 bool SDFstateSpaceMinimalLatencyAnalysis::TransitionSystem::storeState(
         State &s, StatesIter &pos)
 {
-    // Find state in the list of stored states
-    for (StatesIter iter = storedStates.begin();
-            iter != storedStates.end(); iter++)
-    {
-        State &x = *iter;
-        
-        // State s at position iter in the list?
-        if (x == s)
-        {
-            pos = iter;
-            return false;
-        }
-    }
-    
-    // State not found, store it at the end of the list
-    storedStates.push_back(s);
-    
-    // Added state to the end of the list
-    pos = storedStates.end();
+    s.pack(encodedState);
     
-    return true;
+    return storedStates.store(encodedState, pos);
 }
 
 /**  
@@ -200,16 +196,14 @@ TDtime SDFstateSpaceMinimalLatencyAnalysis::TransitionSystem
 	TDtime time = 0;  
 
 	// Check all state from stack till cycle complete  
-	for (StatesIter iter = cycleIter; iter != storedStates.end(); iter++)
+	for (StatesIter iter = cycleIter; iter != storedStates.size(); iter++)
     {
-        State &s = *iter;
-
         // Number of states in cycle is equal to number of iterations 
         // in the period
         nr_fire++;
 
 	    // Time between previous state  
-	    time += s.glbClk;
+	    time += storedStates.getLong(iter, 0);
 	}
 
 	return (TDtime)(nr_fire)/(time);  
@@ -232,22 +226,13 @@ TDtime SDFstateSpaceMinimalLatencyAnalysis::TransitionSystem
  * s. Else it returns false.
  */
 bool SDFstateSpaceMinimalLatencyAnalysis::TransitionSystem::actorReadyToFire(
-        SDFactor *a)
+        const CId a)
 {
     // Check all input ports for tokens
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    for (uint p = flatGraph.inBegin(a); p < flatGraph.inEnd(a); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-        
-        // Actor is destination of the channel?
-        if (p->getType() == SDFport::In)
-        {
-            if (!CH_TOKENS(c->getId(), p->getRate()))
-            {
-                return false;
-            }    
-        }
+        if (!CH_TOKENS(flatGraph.inChannel(p), flatGraph.inRate(p)))
+            return false;
     }
 
     return true;
@@ -260,23 +245,16 @@ bool SDFstateSpaceMinimalLatencyAnalysis::TransitionSystem::actorReadyToFire(
  * position.
  */
 void SDFstateSpaceMinimalLatencyAnalysis::TransitionSystem::startActorFiring(
-        TimedSDFactor *a)
+        const CId a)
 {
-    // Consume tokens from inputs and space for output tokens
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    // Consume tokens from inputs
+    for (uint p = flatGraph.inBegin(a); p < flatGraph.inEnd(a); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-        
-        // Actor is destination of the channel?
-        if (p->getType() == SDFport::In)
-        {
-            CONSUME(c->getId(), p->getRate());
-        }
+        CONSUME(flatGraph.inChannel(p), flatGraph.inRate(p));
     }
 
     // Add actor firing to the list of active firings of this actor
-    currentState.actClk[a->getId()].push_back(a->getExecutionTime());
+    currentState.actClk[a].push_back(flatGraph.executionTime(a));
 }
 
 /**
@@ -285,13 +263,13 @@ void SDFstateSpaceMinimalLatencyAnalysis::TransitionSystem::startActorFiring(
  * the function returns false.
  */
 bool SDFstateSpaceMinimalLatencyAnalysis::TransitionSystem::actorReadyToEnd(
-        SDFactor *a)
+        const CId a)
 {
-    if (currentState.actClk[a->getId()].empty())
+    if (currentState.actClk[a].empty())
         return false;
     
     // First actor firing in sorted list has execution time left?
-    if (currentState.actClk[a->getId()].front() != 0)
+    if (currentState.actClk[a].front() != 0)
         return false;
 
     return true;
@@ -303,22 +281,16 @@ bool SDFstateSpaceMinimalLatencyAnalysis::TransitionSystem::actorReadyToEnd(
  * list of active firings.
  */
 void SDFstateSpaceMinimalLatencyAnalysis::TransitionSystem::endActorFiring(
-        SDFactor *a)
+        const CId a)
 {
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    // Produce tokens on outputs
+    for (uint p = flatGraph.outBegin(a); p < flatGraph.outEnd(a); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-        
-        // Actor is source of the channel?
-        if (p->getType() == SDFport::Out)
-        {
-            PRODUCE(c->getId(), p->getRate());
-        }
+        PRODUCE(flatGraph.outChannel(p), flatGraph.outRate(p));
     }
 
     // Remove the firing from the list of active actor firings
-    currentState.actClk[a->getId()].pop_front();
+    currentState.actClk[a].pop_front();
 }
 
 /**
@@ -392,12 +364,9 @@ TDtime SDFstateSpaceMinimalLatencyAnalysis::TransitionSystem::execSDFgraph(
         previousState.clear();  
 
         // Initial tokens and space
-        for (SDFchannelsIter iter = g->channelsBegin();
-                iter != g->channelsEnd(); iter++)
+        for (uint c = 0; c < flatGraph.nrChannels(); c++)
         {
-            SDFchannel *c = *iter;
-
-            CH(c->getId()) = c->getInitialTokens();
+            CH(c) = flatGraph.initialTokens(c);
         }
     }
 
@@ -411,11 +380,8 @@ TDtime SDFstateSpaceMinimalLatencyAnalysis::TransitionSystem::execSDFgraph(
         }
 
         // Finish actor firings  
-        for (SDFactorsIter iter = g->actorsBegin();
-                iter != g->actorsEnd(); iter++)
+        for (CId a = 0; a < flatGraph.nrActors(); a++)
         {
-            SDFactor *a = *iter;
-            
             while (actorReadyToEnd(a))  
             {
                 // End the actor firing
@@ -424,11 +390,8 @@ TDtime SDFstateSpaceMinimalLatencyAnalysis::TransitionSystem::execSDFgraph(
         }
 
         // Start actor firings  
-        for (SDFactorsIter iter = g->actorsBegin();
-                iter != g->actorsEnd(); iter++)
+        for (CId a = 0; a < flatGraph.nrActors(); a++)
         {
-            TimedSDFactor *a = (TimedSDFactor*)(*iter);
-        
             // Ready to fire actor a?
             while (actorReadyToFire(a))
             {
@@ -477,11 +440,8 @@ SDFtime SDFstateSpaceMinimalLatencyAnalysis::TransitionSystem
         }
 
         // Finish actor firings  
-        for (SDFactorsIter iter = g->actorsBegin();
-                iter != g->actorsEnd(); iter++)
+        for (CId a = 0; a < flatGraph.nrActors(); a++)
         {
-            SDFactor *a = *iter;
-            
             while (actorReadyToEnd(a))  
             {
                 // End the actor firing
@@ -490,30 +450,24 @@ SDFtime SDFstateSpaceMinimalLatencyAnalysis::TransitionSystem
         }
 
         // Start actor firings  
-        for (SDFactorsIter iter = g->actorsBegin();
-                iter != g->actorsEnd(); iter++)
+        for (CId a = 0; a < flatGraph.nrActors(); a++)
         {
-            TimedSDFactor *a = (TimedSDFactor*)(*iter);
-        
             // Ready to fire actor a and allowed to fire?
-            while (actorReadyToFire(a) && demandList[a->getId()] != 0)
+            while (actorReadyToFire(a) && demandList[a] != 0)
             {
                 // Fire actor a
                 startActorFiring(a);
 
                 // Decrease number of remaining actor firings in demand list
-                demandList[a->getId()] = demandList[a->getId()] - 1;
+                demandList[a] = demandList[a] - 1;
             }
         }
 
         // No actor firings left in demand list?
         noActorFiringsNeeded = true;
-        for (SDFactorsIter iter = g->actorsBegin();
-                iter != g->actorsEnd() && noActorFiringsNeeded; iter++)
+        for (CId a = 0; a < flatGraph.nrActors() && noActorFiringsNeeded; a++)
         {
-            TimedSDFactor *a = (TimedSDFactor*)*iter;
-        
-            if (demandList[a->getId()] != 0)
+            if (demandList[a] != 0)
                 noActorFiringsNeeded = false;
         }
         if (noActorFiringsNeeded)
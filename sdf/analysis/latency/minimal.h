@@ -37,6 +37,8 @@
 #define SDF_ANALYSIS_STATESPACE_LATENCY_MINIMAL_H_INCLUDED
 
 #include "../../base/timed/graph.h"
+#include "../statespace/state.h"
+#include "../statespace/flat_graph.h"
 
 /**
  * Minimal latency analysis
@@ -95,6 +97,9 @@ private:
             // Clear state
             void clear();
 
+            // Encode the state into a compact state
+            void pack(SDFcompactState &s) const;
+
             // Output state
             void print(ostream &out);
 
@@ -104,13 +109,13 @@ private:
             unsigned long glbClk;
         };
 
-        // Sequence of states in transition system        
-        typedef list<State>      States;
-        typedef States::iterator StatesIter;
+        // Position of a state in the transition system
+        typedef SDFstatePos StatesIter;
 
         // Constructor
         TransitionSystem(TimedSDFgraph *gr) {
             g = gr;
+            flatGraph.compile(g);
             initOutputActor();   
         };
         
@@ -143,10 +148,10 @@ private:
         TDtime computeThroughput(const StatesIter cycleIter);
 
         // State transitions
-        bool actorReadyToFire(SDFactor *a);
-        void startActorFiring(TimedSDFactor *a);
-        bool actorReadyToEnd(SDFactor *a);
-        void endActorFiring(SDFactor *a);
+        bool actorReadyToFire(const CId a);
+        void startActorFiring(const CId a);
+        bool actorReadyToEnd(const CId a);
+        void endActorFiring(const CId a);
         SDFtime clockStep();
 
         // Output actor
@@ -156,13 +161,19 @@ private:
         TimedSDFgraph *g;
         CId outputActor;
         TCnt outputActorRepCnt;
+
+        // Flat execution model of the graph
+        SDFflatGraph flatGraph;
         
         // Current and previous state
         State currentState; 
         State previousState;
 
-        // List of visited states that are stored
-        States storedStates;
+        // Visited states that are stored
+        SDFstateStore storedStates;
+
+        // Encoding of the state which is being stored
+        SDFcompactState encodedState;
     };
 };
 
@@ -121,6 +121,24 @@ bool SDFstateSpaceSelfTimedLatencyAnalysis::TransitionSystem::State::operator==(
     return true;
 }
 
+/**
+ * pack ()
+ * The function writes the state into the compact state s. The global clock is
+ * stored at word offset zero.
+ */
+void SDFstateSpaceSelfTimedLatencyAnalysis::TransitionSystem::State::pack(
+        SDFcompactState &s) const
+{
+    s.clear();
+    s.pushLong(glbClk);
+
+    for (uint i = 0; i < ch.size(); i++)
+        s.pushWord(ch[i]);
+
+    for (uint i = 0; i < actClk.size(); i++)
+        s.pushClocks(actClk[i]);
+}
+
 /******************************************************************************
  * Transition system
  *****************************************************************************/
@@ -132,26 +150,22 @@ bool SDFstateSpaceSelfTimedLatencyAnalysis::TransitionSystem::State::operator==(
  */
 void SDFstateSpaceSelfTimedLatencyAnalysis::TransitionSystem::initOutputActor()
 {
-    RepetitionVector repVec;
     int min = INT_MAX;
     SDFactor *a = NULL;
 
-    // Compute repetition vector
-    repVec = computeRepetitionVector(g);
-    
     // Select actor with lowest entry in repetition vector as output actor
     for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
     {
-        if (repVec[(*iter)->getId()] < min)
+        if (flatGraph.repetitions((*iter)->getId()) < min)
         {
             a = *iter;
-            min = repVec[a->getId()];
+            min = flatGraph.repetitions(a->getId());
         }
     }
     
     // Set output actor and its repetition vector count
     outputActor = a->getId();
-    outputActorRepCnt = repVec[outputActor];
+    outputActorRepCnt = flatGraph.repetitions(outputActor);
 }
 
 /**
@@ -165,27 +179,9 @@ void SDFstateSpaceSelfTimedLatencyAnalysis::TransitionSystem::initOutputActor()
 bool SDFstateSpaceSelfTimedLatencyAnalysis::TransitionSystem::storeState(
         State &s, StatesIter &pos)
 {
-    // Find state in the list of stored states
-    for (StatesIter iter = storedStates.begin();
-            iter != storedStates.end(); iter++)
-    {
-        State &x = *iter;
-        
-        // State s at position iter in the list?
-        if (x == s)
-        {
-            pos = iter;
-            return false;
-        }
-    }
+    s.pack(encodedState);
     
-    // State not found, store it at the end of the list
-    storedStates.push_back(s);
-    
-    // Added state to the end of the list
-    pos = storedStates.end();
-    
-    return true;
+    return storedStates.store(encodedState, pos);
 }
 
 /**  
@@ -200,16 +196,14 @@ TDtime SDFstateSpaceSelfTimedLatencyAnalysis::TransitionSystem
 	TDtime time = 0;  
 
 	// Check all state from stack till cycle complete  
-	for (StatesIter iter = cycleIter; iter != storedStates.end(); iter++)
+	for (StatesIter iter = cycleIter; iter != storedStates.size(); iter++)
     {
-        State &s = *iter;
-
         // Number of states in cycle is equal to number of iterations 
         // in the period
         nr_fire++;
 
 	    // Time between previous state  
-	    time += s.glbClk;
+	    time += storedStates.getLong(iter, 0);
 	}
 
 	return (TDtime)(nr_fire)/(time);  
@@ -232,22 +226,13 @@ TDtime SDFstateSpaceSelfTimedLatencyAnalysis::TransitionSystem
  * s. Else it returns false.
  */
 bool SDFstateSpaceSelfTimedLatencyAnalysis::TransitionSystem::actorReadyToFire(
-        SDFactor *a)
+        const CId a)
 {
     // Check all input ports for tokens
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    for (uint p = flatGraph.inBegin(a); p < flatGraph.inEnd(a); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-        
-        // Actor is destination of the channel?
-        if (p->getType() == SDFport::In)
-        {
-            if (!CH_TOKENS(c->getId(), p->getRate()))
-            {
-                return false;
-            }    
-        }
+        if (!CH_TOKENS(flatGraph.inChannel(p), flatGraph.inRate(p)))
+            return false;
     }
 
     return true;
@@ -260,23 +245,16 @@ bool SDFstateSpaceSelfTimedLatencyAnalysis::TransitionSystem::actorReadyToFire(
  * position.
  */
 void SDFstateSpaceSelfTimedLatencyAnalysis::TransitionSystem::startActorFiring(
-        TimedSDFactor *a)
+        const CId a)
 {
-    // Consume tokens from inputs and space for output tokens
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    // Consume tokens from inputs
+    for (uint p = flatGraph.inBegin(a); p < flatGraph.inEnd(a); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-        
-        // Actor is destination of the channel?
-        if (p->getType() == SDFport::In)
-        {
-            CONSUME(c->getId(), p->getRate());
-        }
+        CONSUME(flatGraph.inChannel(p), flatGraph.inRate(p));
     }
 
     // Add actor firing to the list of active firings of this actor
-    currentState.actClk[a->getId()].push_back(a->getExecutionTime());
+    currentState.actClk[a].push_back(flatGraph.executionTime(a));
 }
 
 /**
@@ -285,13 +263,13 @@ void SDFstateSpaceSelfTimedLatencyAnalysis::TransitionSystem::startActorFiring(
  * the function returns false.
  */
 bool SDFstateSpaceSelfTimedLatencyAnalysis::TransitionSystem::actorReadyToEnd(
-        SDFactor *a)
+        const CId a)
 {
-    if (currentState.actClk[a->getId()].empty())
+    if (currentState.actClk[a].empty())
         return false;
     
     // First actor firing in sorted list has execution time left?
-    if (currentState.actClk[a->getId()].front() != 0)
+    if (currentState.actClk[a].front() != 0)
         return false;
 
     return true;
@@ -303,22 +281,16 @@ bool SDFstateSpaceSelfTimedLatencyAnalysis::TransitionSystem::actorReadyToEnd(
  * list of active firings.
  */
 void SDFstateSpaceSelfTimedLatencyAnalysis::TransitionSystem::endActorFiring(
-        SDFactor *a)
+        const CId a)
 {
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    // Produce tokens on outputs
+    for (uint p = flatGraph.outBegin(a); p < flatGraph.outEnd(a); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-        
-        // Actor is source of the channel?
-        if (p->getType() == SDFport::Out)
-        {
-            PRODUCE(c->getId(), p->getRate());
-        }
+        PRODUCE(flatGraph.outChannel(p), flatGraph.outRate(p));
     }
 
     // Remove the firing from the list of active actor firings
-    currentState.actClk[a->getId()].pop_front();
+    currentState.actClk[a].pop_front();
 }
 
 /**
@@ -394,12 +366,9 @@ TDtime SDFstateSpaceSelfTimedLatencyAnalysis::TransitionSystem::execSDFgraph(
     previousState.clear();  
 
     // Initial tokens and space
-    for (SDFchannelsIter iter = g->channelsBegin();
-            iter != g->channelsEnd(); iter++)
+    for (uint c = 0; c < flatGraph.nrChannels(); c++)
     {
-        SDFchannel *c = *iter;
-        
-        CH(c->getId()) = c->getInitialTokens();
+        CH(c) = flatGraph.initialTokens(c);
     }
 
     // Fire the actors  
@@ -412,14 +381,11 @@ TDtime SDFstateSpaceSelfTimedLatencyAnalysis::TransitionSystem::execSDFgraph(
         }
 
         // Finish actor firings  
-        for (SDFactorsIter iter = g->actorsBegin();
-                iter != g->actorsEnd(); iter++)
+        for (CId a = 0; a < flatGraph.nrActors(); a++)
         {
-            SDFactor *a = *iter;
-            
             while (actorReadyToEnd(a))  
             {
-                if (outputActor == a->getId())
+                if (outputActor == a)
                 {
                     repCnt++;
                     if (repCnt == outputActorRepCnt)  
@@ -442,7 +408,7 @@ TDtime SDFstateSpaceSelfTimedLatencyAnalysis::TransitionSystem::execSDFgraph(
                 endActorFiring(a);
                 
                 // Firing the destination actor?
-                if (dstActor->getId() == a->getId())
+                if (dstActor->getId() == a)
                 {
                     timeDstFire.push_back(globalTime);
                     
@@ -458,11 +424,8 @@ TDtime SDFstateSpaceSelfTimedLatencyAnalysis::TransitionSystem::execSDFgraph(
         }
 
         // Start actor firings  
-        for (SDFactorsIter iter = g->actorsBegin();
-                iter != g->actorsEnd(); iter++)
+        for (CId a = 0; a < flatGraph.nrActors(); a++)
         {
-            TimedSDFactor *a = (TimedSDFactor*)(*iter);
-        
             // Ready to fire actor a?
             while (actorReadyToFire(a))
             {
@@ -471,7 +434,7 @@ TDtime SDFstateSpaceSelfTimedLatencyAnalysis::TransitionSystem::execSDFgraph(
                 
                 // Only add source actor firing if the reccurent state is not
                 // yet found
-                if (!foundRecurrentState && srcActor->getId() == a->getId())
+                if (!foundRecurrentState && srcActor->getId() == a)
                 {
                     timeSrcFire.push_back(globalTime);
                 }
@@ -125,6 +125,24 @@ bool SDFstateSpaceSelfTimedMinimalLatencyAnalysis::TransitionSystem::State
     return true;
 }
 
+/**
+ * pack ()
+ * The function writes the state into the compact state s. The global clock is
+ * stored at word offset zero.
+ */
+void SDFstateSpaceSelfTimedMinimalLatencyAnalysis::TransitionSystem::State
+        ::pack(SDFcompactState &s) const
+{
+    s.clear();
+    s.pushLong(glbClk);
+
+    for (uint i = 0; i < ch.size(); i++)
+        s.pushWord(ch[i]);
+
+    for (uint i = 0; i < actClk.size(); i++)
+        s.pushClocks(actClk[i]);
+}
+
 /******************************************************************************
  * Transition system
  *****************************************************************************/
@@ -137,14 +155,9 @@ bool SDFstateSpaceSelfTimedMinimalLatencyAnalysis::TransitionSystem::State
 void SDFstateSpaceSelfTimedMinimalLatencyAnalysis::TransitionSystem
         ::initOutputActor(SDFactor *outActor)
 {
-    RepetitionVector repVec;
-
-    // Compute repetition vector
-    repVec = computeRepetitionVector(g);
-
     // Set output actor and its repetition vector count
     outputActor = outActor->getId();
-    outputActorRepCnt = repVec[outputActor];
+    outputActorRepCnt = flatGraph.repetitions(outputActor);
 }
 
 /**
@@ -158,27 +171,9 @@ void SDFstateSpaceSelfTimedMinimalLatencyAnalysis::TransitionSystem
 bool SDFstateSpaceSelfTimedMinimalLatencyAnalysis::TransitionSystem::storeState(
         State &s, StatesIter &pos)
 {
-    // Find state in the list of stored states
-    for (StatesIter iter = storedStates.begin();
-            iter != storedStates.end(); iter++)
-    {
-        State &x = *iter;
-        
-        // State s at position iter in the list?
-        if (x == s)
-        {
-            pos = iter;
-            return false;
-        }
-    }
-    
-    // State not found, store it at the end of the list
-    storedStates.push_back(s);
+    s.pack(encodedState);
     
-    // Added state to the end of the list
-    pos = storedStates.end();
-    
-    return true;
+    return storedStates.store(encodedState, pos);
 }
 
 /**  
@@ -193,16 +188,14 @@ TDtime SDFstateSpaceSelfTimedMinimalLatencyAnalysis::TransitionSystem
 	TDtime time = 0;  
 
 	// Check all state from stack till cycle complete  
-	for (StatesIter iter = cycleIter; iter != storedStates.end(); iter++)
+	for (StatesIter iter = cycleIter; iter != storedStates.size(); iter++)
     {
-        State &s = *iter;
-
         // Number of states in cycle is equal to number of iterations 
         // in the period
         nr_fire++;
 
 	    // Time between previous state  
-	    time += s.glbClk;
+	    time += storedStates.getLong(iter, 0);
 	}
 
 	return (TDtime)(nr_fire)/(time);  
@@ -225,22 +218,13 @@ TDtime SDFstateSpaceSelfTimedMinimalLatencyAnalysis::TransitionSystem
  * s. Else it returns false.
  */
 bool SDFstateSpaceSelfTimedMinimalLatencyAnalysis::TransitionSystem
-        ::actorReadyToFire(SDFactor *a)
+        ::actorReadyToFire(const CId a)
 {
     // Check all input ports for tokens
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    for (uint p = flatGraph.inBegin(a); p < flatGraph.inEnd(a); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-
-        // Actor is destination of the channel?
-        if (p->getType() == SDFport::In)
-        {
-            if (!CH_TOKENS(c->getId(), p->getRate()))
-            {
-                return false;
-            }
-        }
+        if (!CH_TOKENS(flatGraph.inChannel(p), flatGraph.inRate(p)))
+            return false;
     }
 
     return true;
@@ -253,23 +237,16 @@ bool SDFstateSpaceSelfTimedMinimalLatencyAnalysis::TransitionSystem
  * position.
  */
 void SDFstateSpaceSelfTimedMinimalLatencyAnalysis::TransitionSystem
-        ::startActorFiring(TimedSDFactor *a)
+        ::startActorFiring(const CId a)
 {
-    // Consume tokens from inputs and space for output tokens
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    // Consume tokens from inputs
+    for (uint p = flatGraph.inBegin(a); p < flatGraph.inEnd(a); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-        
-        // Actor is destination of the channel?
-        if (p->getType() == SDFport::In)
-        {
-            CONSUME(c->getId(), p->getRate());
-        }
+        CONSUME(flatGraph.inChannel(p), flatGraph.inRate(p));
     }
 
     // Add actor firing to the list of active firings of this actor
-    currentState.actClk[a->getId()].push_back(a->getExecutionTime());
+    currentState.actClk[a].push_back(flatGraph.executionTime(a));
 }
 
 /**
@@ -278,13 +255,13 @@ void SDFstateSpaceSelfTimedMinimalLatencyAnalysis::TransitionSystem
  * the function returns false.
  */
 bool SDFstateSpaceSelfTimedMinimalLatencyAnalysis::TransitionSystem
-        ::actorReadyToEnd(SDFactor *a)
+        ::actorReadyToEnd(const CId a)
 {
-    if (currentState.actClk[a->getId()].empty())
+    if (currentState.actClk[a].empty())
         return false;
     
     // First actor firing in sorted list has execution time left?
-    if (currentState.actClk[a->getId()].front() != 0)
+    if (currentState.actClk[a].front() != 0)
         return false;
 
     return true;
@@ -293,25 +270,19 @@ bool SDFstateSpaceSelfTimedMinimalLatencyAnalysis::TransitionSystem
 /**
  * endActorFiring ()
  * Produce tokens on all output channels and remove the actor firing from the
-c * list of active firings.
+ * list of active firings.
  */
 void SDFstateSpaceSelfTimedMinimalLatencyAnalysis::TransitionSystem
-        ::endActorFiring(SDFactor *a)
+        ::endActorFiring(const CId a)
 {
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    // Produce tokens on outputs
+    for (uint p = flatGraph.outBegin(a); p < flatGraph.outEnd(a); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-
-        // Actor is source of the channel?
-        if (p->getType() == SDFport::Out)
-        {
-            PRODUCE(c->getId(), p->getRate());
-        }
+        PRODUCE(flatGraph.outChannel(p), flatGraph.outRate(p));
     }
 
     // Remove the firing from the list of active actor firings
-    currentState.actClk[a->getId()].pop_front();
+    currentState.actClk[a].pop_front();
 }
 
 /**
@@ -393,26 +364,20 @@ SDFstateSpaceSelfTimedMinimalLatencyAnalysis::TransitionSystem
     previousState.clear();  
 
     // Initial tokens and space
-    for (SDFchannelsIter iter = g->channelsBegin();
-            iter != g->channelsEnd(); iter++)
+    for (uint c = 0; c < flatGraph.nrChannels(); c++)
     {
-        SDFchannel *c = *iter;
-        
-        CH(c->getId()) = c->getInitialTokens();
+        CH(c) = flatGraph.initialTokens(c);
     }
 
     // Fire the actors  
     while (true)  
     {
         // Finish actor firings  
-        for (SDFactorsIter iter = g->actorsBegin();
-                iter != g->actorsEnd(); iter++)
+        for (CId a = 0; a < flatGraph.nrActors(); a++)
         {
-            SDFactor *a = *iter;
-            
             while (actorReadyToEnd(a))  
             {
-                if (outputActor == a->getId())
+                if (outputActor == a)
                 {
                     repCnt++;
                     if (repCnt == outputActorRepCnt)  
@@ -430,7 +395,7 @@ SDFstateSpaceSelfTimedMinimalLatencyAnalysis::TransitionSystem
                                 // timeConstraint was stored in same state
                                 // as the recurrent state?
                                 if (timeConstraint->lastStoredState
-                                        == currentState)
+                                        == recurrentState)
                                 {
                                     lastTimeConstraint->next 
                                                     = timeConstraint;
@@ -455,11 +420,8 @@ SDFstateSpaceSelfTimedMinimalLatencyAnalysis::TransitionSystem
         }
 
         // Start actor firings  
-        for (SDFactorsIter iter = g->actorsBegin();
-                iter != g->actorsEnd(); iter++)
+        for (CId a = 0; a < flatGraph.nrActors(); a++)
         {
-            TimedSDFactor *a = (TimedSDFactor*)(*iter);
-        
             // Ready to fire actor a?
             while (actorReadyToFire(a))
             {
@@ -467,7 +429,7 @@ SDFstateSpaceSelfTimedMinimalLatencyAnalysis::TransitionSystem
                 startActorFiring(a);
                 
                 // Firing the destination actor?
-                if (dstActor->getId() == a->getId())
+                if (dstActor->getId() == a)
                 {
                     // Allocate memory for new timing constraint
                     timeConstraint = new TimingConstraintFiring;
@@ -478,13 +440,14 @@ SDFstateSpaceSelfTimedMinimalLatencyAnalysis::TransitionSystem
                     globalTime = 0;
                     
                     // Remember last state stored (needed to close cycle)
-                    if (!storedStates.empty())
+                    if (storedStates.size() != 0)
                     {
-                        timeConstraint->lastStoredState = storedStates.back();
+                        timeConstraint->lastStoredState
+                                                    = storedStates.size() - 1;
                     }
                     else
                     {
-                        timeConstraint->lastStoredState.glbClk = UINT_MAX;
+                        timeConstraint->lastStoredState = SDFSTATEPOS_NONE;
                     }
 
                     // Default values                    
@@ -555,12 +518,9 @@ TDtime SDFstateSpaceSelfTimedMinimalLatencyAnalysis
     previousState.clear();  
 
     // Initial tokens and space
-    for (SDFchannelsIter iter = g->channelsBegin();
-            iter != g->channelsEnd(); iter++)
+    for (uint c = 0; c < flatGraph.nrChannels(); c++)
     {
-        SDFchannel *c = *iter;
-        
-        CH(c->getId()) = c->getInitialTokens();
+        CH(c) = flatGraph.initialTokens(c);
     }
 
     // Enable all firings of source which can start from the beginning of time
@@ -584,14 +544,11 @@ TDtime SDFstateSpaceSelfTimedMinimalLatencyAnalysis
     while (true)  
     {
         // Finish actor firings  
-        for (SDFactorsIter iter = g->actorsBegin();
-                iter != g->actorsEnd(); iter++)
+        for (CId a = 0; a < flatGraph.nrActors(); a++)
         {
-            SDFactor *a = *iter;
-            
             while (actorReadyToEnd(a))  
             {
-                if (outputActor == a->getId())
+                if (outputActor == a)
                 {
                     repCnt++;
                     if (repCnt == outputActorRepCnt)  
@@ -616,16 +573,13 @@ TDtime SDFstateSpaceSelfTimedMinimalLatencyAnalysis
         }
 
         // Start actor firings  
-        for (SDFactorsIter iter = g->actorsBegin();
-                iter != g->actorsEnd(); iter++)
+        for (CId a = 0; a < flatGraph.nrActors(); a++)
         {
-            TimedSDFactor *a = (TimedSDFactor*)(*iter);
-        
             // Ready to fire actor a?
             while (actorReadyToFire(a))
             {
                 // Current actor is the source actor
-                if (a->getId() == srcActor->getId())
+                if (a == srcActor->getId())
                 {
                     // Is the source allowed to fire?
                     if (nrAllowedSrcFirings > 0)
@@ -649,7 +603,7 @@ TDtime SDFstateSpaceSelfTimedMinimalLatencyAnalysis
                 }
                 
                 // Current actor is the destination actor?
-                if (dstActor->getId() == a->getId())
+                if (dstActor->getId() == a)
                 {
                     dstTimeFire.push_back(globalTime);
 
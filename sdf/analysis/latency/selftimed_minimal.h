@@ -37,6 +37,8 @@
 #define SDF_ANALYSIS_STATESPACE_LATENCY_SELFTIMED_MINIMAL_H_INCLUDED
 
 #include "../../base/timed/graph.h"
+#include "../statespace/state.h"
+#include "../statespace/flat_graph.h"
 
 /**
  * Selftimed latency analysis
@@ -91,6 +93,9 @@ private:
             // Clear state
             void clear();
 
+            // Encode the state into a compact state
+            void pack(SDFcompactState &s) const;
+
             // Output state
             void print(ostream &out);
 
@@ -100,9 +105,8 @@ private:
             unsigned long glbClk;
         };
 
-        // Sequence of states in transition system        
-        typedef list<State>      States;
-        typedef States::iterator StatesIter;
+        // Position of a state in the transition system
+        typedef SDFstatePos StatesIter;
 
         // Timing constraint on a firing
         typedef struct _TimingConstraintFiring
@@ -110,7 +114,7 @@ private:
             CId id;
             SDFtime timeTillNextFiring;
             uint nrFiringsEnabled;
-            TransitionSystem::State lastStoredState;
+            StatesIter lastStoredState;
             bool visit;
             struct _TimingConstraintFiring *next;
         } TimingConstraintFiring;
@@ -118,6 +122,7 @@ private:
         // Constructor
         TransitionSystem(TimedSDFgraph *gr, SDFactor *outActor) {
             g = gr;
+            flatGraph.compile(g);
             initOutputActor(outActor);   
         };
         
@@ -144,10 +149,10 @@ private:
         TDtime computeThroughput(const StatesIter cycleIter);
 
         // State transitions
-        bool actorReadyToFire(SDFactor *a);
-        void startActorFiring(TimedSDFactor *a);
-        bool actorReadyToEnd(SDFactor *a);
-        void endActorFiring(SDFactor *a);
+        bool actorReadyToFire(const CId a);
+        void startActorFiring(const CId a);
+        bool actorReadyToEnd(const CId a);
+        void endActorFiring(const CId a);
         SDFtime clockStep(const uint maxStep = UINT_MAX);
 
         // Output actor
@@ -157,13 +162,19 @@ private:
         TimedSDFgraph *g;
         CId outputActor;
         TCnt outputActorRepCnt;
+
+        // Flat execution model of the graph
+        SDFflatGraph flatGraph;
         
         // Current and previous state
         State currentState; 
         State previousState;
 
-        // List of visited states that are stored
-        States storedStates;
+        // Visited states that are stored
+        SDFstateStore storedStates;
+
+        // Encoding of the state which is being stored
+        SDFcompactState encodedState;
     };
 };
 
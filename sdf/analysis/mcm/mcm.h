@@ -37,6 +37,7 @@
 #define SDF_ANALYSIS_MCM_MCM_H_INCLUDED
 
 #include "../../base/timed/graph.h"
+#include "mcmhoward.h"
 
 /**
  * maximumCycleMeanCycles ()
@@ -45,12 +46,16 @@
  */
 CFraction maximumCycleMeanCycles(TimedSDFgraph *g);
 
+// The algorithms below accept an SDF graph as well as an HSDF graph. The MCM
+// is computed on the HSDF graph of g, which is never constructed explicitly.
+
 /**
  * maximumCycleMeanKarp ()
  * The function computes the maximum cycle mean of a HSDF graph using Karp's
- * algorithm.
+ * algorithm. The algorithm uses O(n) memory for large graphs. The relaxation
+ * of large levels is divided over nrThreads threads.
  */
-CFraction maximumCycleMeanKarp(TimedSDFgraph *g);
+CFraction maximumCycleMeanKarp(TimedSDFgraph *g, const uint nrThreads = 1);
 
 /**
  * maximumCycleMeanHoward ()
@@ -59,6 +64,14 @@ CFraction maximumCycleMeanKarp(TimedSDFgraph *g);
  */
 CFraction maximumCycleMeanHoward(TimedSDFgraph *g);
 
+/**
+ * maximumCycleMeanHoward ()
+ * The function computes the maximum cycle mean of a HSDF graph using Howard's
+ * algorithm. The workspace of the solver is reused between calls. A solver
+ * should not be used by two threads at the same time.
+ */
+CFraction maximumCycleMeanHoward(TimedSDFgraph *g, MCMhoward &solver);
+
 /**
  * maximumCycleMeanDasdanGupta ()
  * The function computes the maximum cycle mean of a HSDF graph using
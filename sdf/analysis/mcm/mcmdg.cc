@@ -47,18 +47,17 @@
  * Dasdan-Gupta's algorithm.
  */
 static
-double mcmDG(MCMgraph *mcmGraph)
+double mcmDG(MCMgraphCSR &g)
 {
-    int k, n;
+    int k, n, u;
     int *level;
     int **pi, **d;
     double l, ld;
-    MCMnode *u;
     list<int> Q_k;
-    list<MCMnode*> Q_u;
+    list<int> Q_u;
 
     // Allocate memory
-    n = mcmGraph->nrNodes();
+    n = g.nrNodes();
     level = new int [n];
     pi = new int* [n+1];
     d = new int* [n+1];
@@ -75,27 +74,27 @@ double mcmDG(MCMgraph *mcmGraph)
     pi[0][0] = -1;
     level[0] = 0;
     Q_k.push_back(0);
-    Q_u.push_back(mcmGraph->nodes.front());
+    Q_u.push_back(0);
 
     // Compute the distances
     k = Q_k.front(); Q_k.pop_front();
     u = Q_u.front(); Q_u.pop_front();
     do
     {
-        for (MCMedgesIter iter = u->out.begin(); iter != u->out.end(); iter++)
+        for (uint i = g.outIdx[u]; i < g.outIdx[u+1]; i++)
         {
-            MCMedge *e = *iter;
-            MCMnode *v = e->dst;
+            uint e = g.outEdge[i];
+            uint v = g.dst[e];
 
-            if (level[v->id] < k+1)
+            if (level[v] < k+1)
             {
                 Q_k.push_back(k+1);
                 Q_u.push_back(v);
-                pi[k+1][v->id] = level[v->id];
-                level[v->id] = k + 1;
-                d[k+1][v->id] = -INT_MAX;
+                pi[k+1][v] = level[v];
+                level[v] = k + 1;
+                d[k+1][v] = -INT_MAX;
             }
-            d[k+1][v->id] = MAX(d[k+1][v->id],d[k][u->id]+e->w);
+            d[k+1][v] = MAX(d[k+1][v],d[k][u]+g.w[e]);
         }
         k = Q_k.front(); Q_k.pop_front();
         u = Q_u.front(); Q_u.pop_front();
@@ -103,19 +102,16 @@ double mcmDG(MCMgraph *mcmGraph)
 
     // Compute lamda using Karp's theorem
     l = -INT_MAX;
-    for (MCMnodesIter iter = mcmGraph->nodes.begin();
-            iter != mcmGraph->nodes.end(); iter++)
+    for (u = 0; u < n; u++)
     {
-        u = *iter;
-
-        if (level[u->id] == n)
+        if (level[u] == n)
         {
             ld = INT_MAX;
-            k = pi[n][u->id];
+            k = pi[n][u];
             while (k > -1)
             {
-                ld = MIN(ld, (double)(d[n][u->id]-d[k][u->id]) / (double)(n-k));
-                k = pi[k][u->id];
+                ld = MIN(ld, (double)(d[n][u]-d[k][u]) / (double)(n-k));
+                k = pi[k][u];
             }
             l = MAX(l, ld);
         }
@@ -144,10 +140,11 @@ CFraction mcmDasdanGupta(TimedSDFgraph *g)
 {
     MCMgraphs components;
     MCMgraph *mcmGraph;
+    MCMgraphCSR csr;
     double mcm = 0, mcmComp;
 
-    // Transform the HSDF to a weighted directed graph
-    mcmGraph = transformHSDFtoMCMgraph(g);
+    // Transform the (H)SDF graph to a weighted directed graph
+    mcmGraph = transformSDFtoMCMgraph(g);
 
     // Extract the strongly connected component from the graph
     // According to the Max-Plus book there is exactly one strongly
@@ -161,14 +158,17 @@ CFraction mcmDasdanGupta(TimedSDFgraph *g)
     {
         MCMgraph *comp = *iter;
 
-        // Remove all hidden edges and nodes from the graph and assign new id's
-        relabelMCMgraph(comp);
+        // Compressed sparse row representation of the component
+        csr.init(comp);
 
         // Compute MCM of the component
-        mcmComp = mcmDG(comp);
+        mcmComp = mcmDG(csr);
 
         if (mcmComp > mcm)
             mcm = mcmComp;
+
+        // Cleanup
+        delete comp;
     }
 
     // Cleanup
@@ -186,14 +186,6 @@ CFraction maximumCycleMeanDasdanGupta(TimedSDFgraph *g)
 {
     CFraction mcmGraph;
     
-    // Check that graph g is an HSDF graph
-    if (!isHSDFgraph(g))
-        throw CException("Graph is not an HSDF graph.");    
-
-    // Check that the graph g is a strongly connected graph
-    if (!isStronglyConnectedGraph(g))
-        throw CException("Graph is not strongly connected.");
-        
     mcmGraph = mcmDasdanGupta(g);
     
     return mcmGraph;
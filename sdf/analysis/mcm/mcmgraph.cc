@@ -37,6 +37,8 @@
 #include "base/base.h"
 #include "mcmgraph.h"
 #include "../../base/hsdf/check.h"
+#include "../../base/algo/repetition_vector.h"
+#include "../../base/algo/components.h"
 
 /**
  * ~MCMgraph
@@ -124,6 +126,128 @@ void createInitialMCMgraph(TimedSDFgraph *g, MCMgraph *mcmGraph)
     }
 }
 
+/**
+ * createInitialMCMgraphFromSDF ()
+ * The function creates the same weighted directed graph as the function
+ * createInitialMCMgraph creates for the HSDF graph of the SDF graph g. The
+ * HSDF graph itself is not constructed. Each firing of an actor becomes a node
+ * and each token which is communicated in an iteration becomes an edge. The
+ * nodes and edges are numbered in the order in which transformSDFtoHSDF
+ * creates the actors and channels of the HSDF graph.
+ */
+static
+void createInitialMCMgraphFromSDF(TimedSDFgraph *g, MCMgraph *mcmGraph)
+{
+    RepetitionVector repVec = computeRepetitionVector(g);
+    vector<MCMnode*> nodes;
+    v_uint firstNode(g->nrActors());
+    uint edgeId = 0;
+    
+    // Create a node for every firing of every actor
+    for (SDFactorsIter iter = g->actorsBegin(); 
+            iter != g->actorsEnd(); iter++)
+    {
+        SDFactor *a = *iter;
+        
+        firstNode[a->getId()] = nodes.size();
+        
+        for (int i = 0; i < repVec[a->getId()]; i++)
+        {
+            MCMnode *n = new MCMnode;
+            
+            n->id = nodes.size();
+            n->visible = true;
+            nodes.push_back(n);
+            mcmGraph->nodes.push_back(n);
+        }
+    }
+    
+    // Create an edge for every token sent over a channel in an iteration
+    for (SDFchannelsIter iter = g->channelsBegin();
+            iter != g->channelsEnd(); iter++)
+    {
+        SDFchannel *c = *iter;
+        SDFactor *srcA = c->getSrcActor();
+        SDFactor *dstA = c->getDstActor();
+        uint nA = c->getSrcPort()->getRate();
+        uint nB = c->getDstPort()->getRate();
+        uint qA = repVec[srcA->getId()];
+        uint qB = repVec[dstA->getId()];
+        uint d = c->getInitialTokens();
+        int w = ((TimedSDFactor*)srcA)->getExecutionTime();
+
+        ASSERT(w > 0, "Execution time must be > 0.")
+        
+        for (uint i = 0; i < qA; i++)
+        {
+            for (uint k = 0; k < nA; k++)
+            {
+                // Position of the token in the sequence of tokens on c
+                uint x = d + i * nA + k;
+                MCMedge *e = new MCMedge;
+                
+                e->id = edgeId++;
+                e->visible = true;
+                e->d = x / (nB * qB);
+                e->w = w;
+                e->src = nodes[firstNode[srcA->getId()] + i];
+                e->dst = nodes[firstNode[dstA->getId()] 
+                                    + (x % (nB * qB)) / nB];
+                e->src->out.push_back(e);
+                e->dst->in.push_back(e);
+                mcmGraph->edges.push_back(e);
+            }
+        }
+    }
+}
+
+/**
+ * isStronglyConnectedMCMgraph ()
+ * The function checks that all nodes of the graph can be reached from the
+ * first node and that the first node can be reached from all nodes.
+ */
+static
+bool isStronglyConnectedMCMgraph(MCMgraph *g)
+{
+    vector<MCMnode*> stack;
+    
+    if (g->nodes.empty())
+        return false;
+    
+    for (uint transpose = 0; transpose < 2; transpose++)
+    {
+        vector<bool> visited(g->nodes.size(), false);
+        uint nrVisited = 1;
+        
+        visited[g->nodes.front()->id] = true;
+        stack.push_back(g->nodes.front());
+        
+        while (!stack.empty())
+        {
+            MCMnode *u = stack.back();
+            MCMedges &edges = (transpose == 0 ? u->out : u->in);
+            stack.pop_back();
+            
+            for (MCMedgesIter iter = edges.begin(); iter != edges.end(); iter++)
+            {
+                MCMnode *v = (transpose == 0 ? (*iter)->dst : (*iter)->src);
+                
+                if (!visited[v->id])
+                {
+                    visited[v->id] = true;
+                    nrVisited++;
+                    stack.push_back(v);
+                }
+            }
+        }
+        
+        if (nrVisited != g->nodes.size())
+            return false;
+    }
+    
+    return true;
+}
+
 /**
  * splitMCMedgeToSequence ()
  * The function converts an MCM edge with more then one delay
@@ -445,6 +569,45 @@ MCMgraph *transformHSDFtoMCMgraph(TimedSDFgraph *g, bool mcmFormulation)
     return mcmGraph;
 }
 
+/**
+ * transformSDFtoMCMgraph ()
+ * The function converts an SDF graph to the weighted directed graph which
+ * transformHSDFtoMCMgraph creates for the HSDF graph of g. The graph is built
+ * directly from the SDF graph and its repetition vector. An exception is
+ * thrown when the HSDF graph of g is not strongly connected.
+ */
+MCMgraph *transformSDFtoMCMgraph(TimedSDFgraph *g, bool mcmFormulation)
+{
+    MCMgraph *mcmGraph;
+    
+    // An HSDF graph is converted as before
+    if (isHSDFgraph(g))
+    {
+        // Check that the graph g is a strongly connected graph
+        if (!isStronglyConnectedGraph(g))
+            throw CException("Graph is not strongly connected.");
+        
+        return transformHSDFtoMCMgraph(g, mcmFormulation);
+    }
+    
+    // Create an initial directed weighted graph
+    mcmGraph = new MCMgraph;
+    createInitialMCMgraphFromSDF(g, mcmGraph);
+    
+    // Check that the HSDF graph is a strongly connected graph
+    if (!isStronglyConnectedMCMgraph(mcmGraph))
+    {
+        delete mcmGraph;
+        throw CException("Graph is not strongly connected.");
+    }
+    
+    // Convert the initial directed weighted graph to the required form
+    if (mcmFormulation)
+        addLongestDelayEdgesToMCMgraph(mcmGraph);
+
+    return mcmGraph;
+}
+
 /**
  * getAdjacentNodes ()
  * The function returns a list with nodes directly reachable from
@@ -825,6 +988,80 @@ void stronglyConnectedMCMgraph(MCMgraph *g, MCMgraphs &components)
     free(pi);
 }
 
+/**
+ * init ()
+ * The function builds the compressed sparse row representation of all visible
+ * nodes and edges of the graph g. The edges are placed with a counting sort on
+ * their destination node.
+ */
+void MCMgraphCSR::init(MCMgraph *g)
+{
+    uint nrNodes = 0, nrEdges = 0, maxId = 0;
+    v_uint mapId, pos;
+
+    // Re-map the id of all visible nodes to the range [0, nrNodes)
+    for (MCMnodesIter iter = g->nodes.begin(); iter != g->nodes.end(); iter++)
+        if ((*iter)->id > maxId) maxId = (*iter)->id;
+    mapId.resize(maxId + 1);
+    for (MCMnodesIter iter = g->nodes.begin(); iter != g->nodes.end(); iter++)
+    {
+        MCMnode *n = *iter;
+        
+        if (n->visible)
+        {
+            mapId[n->id] = nrNodes;
+            nrNodes++;
+        }
+    }
+    
+    // Count the incoming and outgoing edges of every node
+    inIdx.assign(nrNodes + 1, 0);
+    outIdx.assign(nrNodes + 1, 0);
+    for (MCMedgesIter iter = g->edges.begin(); iter != g->edges.end(); iter++)
+    {
+        MCMedge *e = *iter;
+        
+        if (e->visible)
+        {
+            inIdx[mapId[e->dst->id] + 1]++;
+            outIdx[mapId[e->src->id] + 1]++;
+            nrEdges++;
+        }
+    }
+    for (uint v = 0; v < nrNodes; v++)
+    {
+        inIdx[v + 1] += inIdx[v];
+        outIdx[v + 1] += outIdx[v];
+    }
+    
+    // Place the edges sorted on their destination
+    src.resize(nrEdges);
+    dst.resize(nrEdges);
+    w.resize(nrEdges);
+    d.resize(nrEdges);
+    pos.assign(inIdx.begin(), inIdx.end() - 1);
+    for (MCMedgesIter iter = g->edges.begin(); iter != g->edges.end(); iter++)
+    {
+        MCMedge *e = *iter;
+        
+        if (e->visible)
+        {
+            uint k = pos[mapId[e->dst->id]]++;
+            
+            src[k] = mapId[e->src->id];
+            dst[k] = mapId[e->dst->id];
+            w[k] = e->w;
+            d[k] = e->d;
+        }
+    }
+    
+    // List the outgoing edges of every node
+    outEdge.resize(nrEdges);
+    pos.assign(outIdx.begin(), outIdx.end() - 1);
+    for (uint k = 0; k < nrEdges; k++)
+        outEdge[pos[src[k]]++] = k;
+}
+
 /**
  * relabelMCMgraph ()
  * The function removes all hidden nodes and edges from the graph. All visible
@@ -96,6 +96,44 @@ public:
 typedef list<MCMgraph*>      MCMgraphs;
 typedef MCMgraphs::iterator  MCMgraphsIter;
 
+/**
+ * MCMgraphCSR
+ * Compressed sparse row representation of the visible nodes and edges of an
+ * MCM graph. The nodes are numbered [0, nrNodes()) in the order in which they
+ * appear in the graph. The edges are stored in contiguous arrays which are
+ * sorted on the destination node of the edges. The incoming edges of node v
+ * are the positions [inIdx[v], inIdx[v+1]) of these arrays. The outgoing
+ * edges of node u are listed in outEdge[outIdx[u]] up to outEdge[outIdx[u+1]].
+ * Edges with the same destination keep their order in the graph.
+ */
+class MCMgraphCSR
+{
+public:
+    // Constructor
+    MCMgraphCSR() { inIdx.assign(1, 0); outIdx.assign(1, 0); };
+
+    // Destructor
+    ~MCMgraphCSR() {};
+
+    // Build the representation from the visible part of graph g
+    void init(MCMgraph *g);
+
+    // Size
+    uint nrNodes() const { return inIdx.size() - 1; };
+    uint nrEdges() const { return src.size(); };
+
+    // Edges sorted on destination
+    vector<uint> inIdx;
+    vector<uint> src;
+    vector<uint> dst;
+    vector<int> w;
+    vector<uint> d;
+
+    // Outgoing edges of the nodes
+    vector<uint> outIdx;
+    vector<uint> outEdge;
+};
+
 /**
  * transformHSDFtoMCMgraph ()
  * The function converts an HSDF graph to a weighted directed graph
@@ -107,6 +145,16 @@ typedef MCMgraphs::iterator  MCMgraphsIter;
  */
 MCMgraph *transformHSDFtoMCMgraph(TimedSDFgraph *g, bool mcmFormulation = true);
 
+/**
+ * transformSDFtoMCMgraph ()
+ * The function converts an SDF graph to the weighted directed graph which
+ * transformHSDFtoMCMgraph creates for its HSDF graph. The MCM graph is
+ * constructed directly from the SDF graph and its repetition vector, without
+ * creating the actors, ports and channels of the HSDF graph. An exception is
+ * thrown when the HSDF graph is not strongly connected.
+ */
+MCMgraph *transformSDFtoMCMgraph(TimedSDFgraph *g, bool mcmFormulation = true);
+
 /**
  * Extract the strongly connected components from the graph. These components
  * are returned as a set of MCM graphs. All nodes which belong to at least
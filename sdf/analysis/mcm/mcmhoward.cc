@@ -44,7 +44,8 @@
  * what you give them.   Happy coding!
  */
 
-#include "mcmgraph.h"
+#include "mcmhoward.h"
+#include "mcm.h"
 #include "../../base/hsdf/check.h"
 #include "../../base/algo/components.h"
 
@@ -60,50 +61,56 @@
 
 #define EPSILON -HUGE_VAL
 
-static int *ij;
-static double *a;
-static int nnodes;
-static int narcs;
-static double *chi;
-static double *v;
-static int *pi;
-static int *NIterations;
-static int *NComponents;
-
-static int *newpi=NULL; /*  new policy */
-
-/* The inverse policy is coded by a linearly chained list.
- * piinv_idx[i]= pointer to the chain of inverses of node i.
+/**
+ * MCMhoward ()
+ * Constructor.
  */
-static 	int *piinv_idx=NULL;
-
-/* piinv_idx[j]= pointer to the next inverse */
-static	int *piinv_succ=NULL;
-
-/* corresponding node  */
-static	int *piinv_elem=NULL;
-
-/* piinv_last[i]= last inverse of i */
-static	int *piinv_last=NULL;
+MCMhoward::MCMhoward()
+{
+    ij = NULL;
+    a = NULL;
+    nnodes = 0;
+    narcs = 0;
+    chi = NULL;
+    v = NULL;
+    pi = NULL;
+    NComponents = NULL;
+    lambda = 0;
+    epsilon = 0;
+    color = 1;
+}
 
-static	double *c=NULL;
-static	double *vaux=NULL;
-static	double *newc=NULL;
-static	double *newchi=NULL;
-static 	int *visited=NULL;
-static	int *component=NULL;
-static  double lambda=0;
-static  double epsilon=0;
-static  int color=1;
+/**
+ * reserve ()
+ * The function makes sure that the workspace can hold a graph with NNODES
+ * nodes and NARCS arcs. The workspace is never shrunk.
+ */
+void MCMhoward::reserve(const int NNODES, const int NARCS)
+{
+    uint n = NNODES;
 
+    if (newpi.size() >= n)
+        return;
+    
+    newpi.resize(n);
+    piinv_idx.resize(n);
+    piinv_succ.resize(n);
+    piinv_elem.resize(n);
+    piinv_last.resize(n);
+    visited.resize(n);
+    component.resize(n);
+    c.resize(n);
+    newc.resize(n);
+    vaux.resize(n);
+    newchi.resize(n);
+}
 
 /**
  * Epsilon ()
  * The termination tests are performed up to an epsilon constant, which is fixed
  * heuristically by the following routine.
  */
-static
-void Epsilon(double *a,int narcs,double *epsilon)
+void MCMhoward::Epsilon()
 { 
     int i;
     double MAX,MIN;
@@ -119,7 +126,7 @@ void Epsilon(double *a,int narcs,double *epsilon)
             MIN=a[i];
     }
 
-    *epsilon=(MAX-MIN)*0.000000001;
+    epsilon=(MAX-MIN)*0.000000001;
 }
 
 /**
@@ -130,8 +137,7 @@ void Epsilon(double *a,int narcs,double *epsilon)
  * initial policy seems to cut the number of iterations by a factor 1.5, by 
  * comparison with a random initial policy.
  */ 
-static
-void Initial_Policy()
+void MCMhoward::Initial_Policy()
 {
     int i;  
 
@@ -151,8 +157,7 @@ void Initial_Policy()
     }
 }
 
-static 
-void New_Build_Inverse()
+void MCMhoward::New_Build_Inverse()
 {
     int i,j,locus;
     int ptr=0;
@@ -186,8 +191,7 @@ void New_Build_Inverse()
     }
 }
 
-static 
-void Init_Depth_First()
+void MCMhoward::Init_Depth_First()
 {
     int j;
     
@@ -198,33 +202,29 @@ void Init_Depth_First()
     }
 }
 
-
-
 /**
  *
  * Given the value of v at initial point i, we compute v[j] for all predecessor 
  * j of i, according to the spectral equation, v[j]+ lambda = A(arc from j to i)
  * v[i] the array visited is changed by side effect.
  */
-static
-void New_Depth_First_Label(int i)
+void MCMhoward::New_Depth_First_Label(int i)
 { 
-    int nexti,a;
-    a=piinv_idx[i];
-    while (a != -1 && visited[piinv_elem[a]]==0)
+    int nexti,arc;
+    arc=piinv_idx[i];
+    while (arc != -1 && visited[piinv_elem[arc]]==0)
     {
-        nexti=piinv_elem[a];
+        nexti=piinv_elem[arc];
         visited[nexti]=1;
         v[nexti]= -lambda + c[nexti]+ v[i];
         component[nexti]=color;
         chi[nexti]= lambda;
         New_Depth_First_Label(nexti);
-        a=piinv_succ[a];
+        arc=piinv_succ[arc];
     }
 }
 
-static
-void Visit_From(int initialpoint,int color)
+void MCMhoward::Visit_From(int initialpoint,int color)
 {
     int index,newindex,i;
     double weight;
@@ -263,8 +263,7 @@ void Visit_From(int initialpoint,int color)
  * Value()
  * Computes the value (v,chi) associated with a policy pi.
  */
-static
-void Value()
+void MCMhoward::Value()
 {
     int initialpoint;
     color=1;
@@ -284,8 +283,7 @@ void Value()
     *NComponents=--color;
 }
 
-static
-void Init_Improve()
+void MCMhoward::Init_Improve()
 {
   int i;
 
@@ -298,8 +296,7 @@ void Init_Improve()
     }
 }
 
-static
-void First_Order_Improvement(int *improved)
+void MCMhoward::First_Order_Improvement(int *improved)
 {
     int i;
     for (i=0;i<narcs; i++)
@@ -314,8 +311,7 @@ void First_Order_Improvement(int *improved)
     }
 }
 
-static
-void Second_Order_Improvement(int *improved)
+void MCMhoward::Second_Order_Improvement(int *improved)
 {
     int i;     
     double w;
@@ -355,8 +351,7 @@ void Second_Order_Improvement(int *improved)
     }
 }
 
-static
-void Improve(int *improved)
+void MCMhoward::Improve(int *improved)
 {
     *improved=0;
     Init_Improve();
@@ -369,66 +364,29 @@ void Improve(int *improved)
         Second_Order_Improvement(improved);
 }
 
-static
-void Allocate_Memory()
-{
-    newpi=(int *)calloc(nnodes, sizeof(int));
-    piinv_idx=(int *)calloc(nnodes, sizeof(int));
-    piinv_succ=(int *)calloc(nnodes, sizeof(int));
-    piinv_elem=(int *)calloc(nnodes, sizeof(int));
-    piinv_last=(int *)calloc(nnodes, sizeof(int));
-    visited=(int *)calloc(nnodes, sizeof(int));
-    component=(int *)calloc(nnodes, sizeof(int));
-    c=(double *)calloc(nnodes, sizeof(double));
-    newc=(double *)calloc(nnodes, sizeof(double));
-    vaux=(double *)calloc(nnodes, sizeof(double));
-    newchi=(double *)calloc(nnodes, sizeof(double));
-    
-    if ((newchi==NULL)|| (vaux==NULL) || (newc==NULL)|| (c==NULL) 
-            || (component==NULL) || (visited==NULL)|| (piinv_idx==NULL)
-            ||(piinv_succ== NULL) ||( piinv_elem==NULL)|| (  piinv_last==NULL)
-            || (newpi==NULL))
-    {
-        throw CException("Failed allocation memory");
-    }
-}
-
-static
-void Free_Memory()
-{
-    free(newpi);
-    free(piinv_idx);
-    free(piinv_succ);
-    free(piinv_elem);
-    free(piinv_last);
-    free(visited);
-    free(component);
-    free(c);
-    free(newc);
-    free(vaux);
-    free(newchi);
-}
-
-static void Check_Rows()
+/**
+ * Check_Rows ()
+ * Every node must have at least one outgoing arc. The array visited is used
+ * to mark the nodes with an outgoing arc.
+ */
+void MCMhoward::Check_Rows()
 { 
     int i;
-    int *u=NULL;
-    u=(int *)calloc(nnodes,sizeof(int));
+
+    for (i=0; i<nnodes;i++ )
+        visited[i]=0;
 
     for (i=0; i<narcs;i++ )
-        u[ij[2*i]]=1;
+        visited[ij[2*i]]=1;
 
     for (i=0; i<nnodes;i++ )
     {
-        if (u[i]==0)
+        if (visited[i]==0)
             throw CException("Failed check on rows in Howard's MCM algorithm.");
     }
-
-    free(u);
 }
 
-static
-void Security_Check()
+void MCMhoward::Security_Check()
 {
     if (nnodes<1)
         throw CException("Howard: number of nodes must be a positive integer.");
@@ -439,25 +397,9 @@ void Security_Check()
     Check_Rows();
 }
 
-static
-void Import_Arguments(int *IJ, double *A,int NNODES, int NARCS, double *CHI,
-        double *V, int *POLICY, int *NITERATIONS, int *NCOMPONENTS)
-{
-    ij=IJ;
-    a=A;
-    nnodes=NNODES;
-    narcs=NARCS;
-    chi=CHI;
-    v=V;
-    pi=POLICY;
-    NIterations=NITERATIONS;
-    NComponents=NCOMPONENTS;
-}
-
-static 
-void Update_Policy()
+void MCMhoward::Update_Policy()
 {
-    register int i;
+    int i;
 
     for (i=0;i<nnodes;i++)
     {
@@ -467,15 +409,8 @@ void Update_Policy()
     }
 }
 
-static
-void End_Message()
-{
-    if (*NIterations ==MAX_NIterations)
-        throw CException("Howard: exceeded maximum number of iterations.");
-}
-
 /**
- * Howard ()
+ * solve ()
  * Howard Policy Iteration Algorithm for Max Plus Matrices.
  *
  * INPUT of Howard Algorithm:
@@ -491,9 +426,6 @@ void End_Message()
  * REQUIRES: O(nnodes) SPACE
  * One iteration requires: O(narcs+nnodes) TIME
  *  
- * The following variables should be defined in the environment from which the
- * Howard routine is called.
- *
  * INPUT VARIABLES
  * int NNODES;  number of nodes of the graph 
  * int NARCS;   number of arcs of the graph 
@@ -511,17 +443,25 @@ void End_Message()
  * int NCOMPONENTS; the number of connected components of the optimal
  *               policy which is returned.
  */
-static
-void Howard(int *IJ, double *A,int NNODES,int NARCS,double *CHI,double *V,
-        int *POLICY,int *NITERATIONS,int *NCOMPONENTS)
+void MCMhoward::solve(const int *IJ, const double *A, const int NNODES,
+        const int NARCS, double *CHI, double *V, int *POLICY,
+        int &NITERATIONS, int &NCOMPONENTS)
 {
     int improved = 0;
-    *NITERATIONS = 0;
+    NITERATIONS = 0;
     
-    Import_Arguments(IJ,A,NNODES,NARCS,CHI,V,POLICY,NITERATIONS,NCOMPONENTS);
+    ij=IJ;
+    a=A;
+    nnodes=NNODES;
+    narcs=NARCS;
+    chi=CHI;
+    v=V;
+    pi=POLICY;
+    NComponents=&NCOMPONENTS;
+
+    reserve(nnodes, narcs);
     Security_Check();
-    Allocate_Memory();
-    Epsilon(a,narcs,&epsilon);
+    Epsilon();
     Initial_Policy();
     New_Build_Inverse();
     
@@ -531,55 +471,64 @@ void Howard(int *IJ, double *A,int NNODES,int NARCS,double *CHI,double *V,
         Improve(&improved);
         Update_Policy();
         New_Build_Inverse();
-        (*NIterations)++;
+        NITERATIONS++;
     }
-    while ((improved != 0) && *NIterations <MAX_NIterations);
+    while ((improved != 0) && NITERATIONS <MAX_NIterations);
     
-    End_Message();
-    Free_Memory();
+    if (NITERATIONS == MAX_NIterations)
+        throw CException("Howard: exceeded maximum number of iterations.");
 }
 
 /**
- * convertMCMgraphToMatrix ()
- * The function converts a weighted directed graph used in the MCM algorithms
- * to a sparse amtrix input for Howard's algorithm.
+ * maximumCycleMean ()
+ * The function converts the weighted directed graph g to a sparse matrix and
+ * computes its maximum cycle mean using Howard's algorithm. Only the visible
+ * nodes and edges of g are considered.
  */
-static
-void convertMCMgraphToMatrix(MCMgraph *g, int *IJ, double *A)
+CFraction MCMhoward::maximumCycleMean(MCMgraph *g)
 {
-    int k = 0;
-    uint i = 0, j = 0;
-    v_uint mapId(g->nodes.size());
+    CFraction mcm;
+    int nrNodes, nrEdges, nrIterations, nrComponents;
     
-    // Re-map the id of all visible nodes back to the range [0, g->nrNodes())
-    for (MCMnodesIter iter = g->nodes.begin(); iter != g->nodes.end(); iter++)
+    // Compressed sparse row representation of the visible part of the graph
+    csr.init(g);
+
+    // Number of nodes and edges in the graph
+    nrNodes = csr.nrNodes(); 
+    nrEdges = csr.nrEdges();
+    
+    // Reserve memory for matrices
+    if (graphA.size() < (uint)nrEdges)
     {
-        MCMnode *n = *iter;
-        
-        if (n->visible)
-        {
-            mapId[i] = j;
-            j++;
-        }
-        i++;
+        graphIJ.resize(2*nrEdges);
+        graphA.resize(nrEdges);
     }
-    
+    if (graphV.size() < (uint)nrNodes)
+    {
+        graphV.resize(nrNodes);
+        graphChi.resize(nrNodes);
+        graphPolicy.resize(nrNodes);
+    }
+
     // Create an entry in the matrices for each edge
-    for (MCMedgesIter iter = g->edges.begin(); iter != g->edges.end(); iter++)
+    for (int k = 0; k < nrEdges; k++)
     {
-        MCMedge *e = *iter;
-        
-        // Is the edge a existing edge in the graph?
-        if (e->visible)
-        {
-            IJ[2*k] = mapId[e->src->id];
-            IJ[2*k+1] = mapId[e->dst->id]; 
-            A[k] = e->w;
-            
-            // Next edge
-            k++;
-        }
+        graphIJ[2*k] = csr.src[k];
+        graphIJ[2*k+1] = csr.dst[k]; 
+        graphA[k] = csr.w[k];
     }
+
+    // Run Howard's algorithm
+    solve(&graphIJ[0], &graphA[0], nrNodes, nrEdges, &graphChi[0],
+            &graphV[0], &graphPolicy[0], nrIterations, nrComponents);
+    
+    // The MCM is equal to maximum entry in the cycle time vector
+    mcm = 0;
+    for (int n = 0; n < nrNodes; n++)
+        if (mcm < graphChi[n])
+            mcm = graphChi[n];
+    
+    return mcm;
 }
 
 /**
@@ -588,17 +537,14 @@ void convertMCMgraphToMatrix(MCMgraph *g, int *IJ, double *A)
  * algorithm.
  */
 static
-CFraction mcmHoward(TimedSDFgraph *g)
+CFraction mcmHoward(TimedSDFgraph *g, MCMhoward &solver)
 {
     CFraction mcm;
     MCMgraphs components;
     MCMgraph *mcmGraph;
-    int nrNodes, nrEdges, nrIterations, nrComponents;
-    double *A, *v, *chi;
-    int *policy, *IJ;
     
-    // Transform the HSDF to a weighted directed graph
-    mcmGraph = transformHSDFtoMCMgraph(g);
+    // Transform the (H)SDF graph to a weighted directed graph
+    mcmGraph = transformSDFtoMCMgraph(g);
 
     // Extract the strongly connected component from the graph
     // According to the Max-Plus book there is exactly one strongly
@@ -606,36 +552,15 @@ CFraction mcmHoward(TimedSDFgraph *g)
     // connected (H)SDF graph.
     stronglyConnectedMCMgraph(mcmGraph, components);
 
-    // Number of nodes and edges in the graph
-    nrNodes = mcmGraph->nrNodes(); 
-    nrEdges = mcmGraph->nrEdges();
-    
-    // Allocate memory for matrices
-    IJ = new int [2*nrEdges];
-    A = new double [nrEdges];
-    v = new double [nrNodes];
-    chi = new double [nrNodes];
-    policy = new int [nrNodes];
-    
-    // Convert the graph to a sparse matrix
-    convertMCMgraphToMatrix(mcmGraph, IJ, A);
-
     // Run Howard's algorithm
-    Howard(IJ, A, nrNodes, nrEdges, chi, v, policy, &nrIterations,
-            &nrComponents);
-    
-    // The MCM is equal to maximum entry in the cycle time vector
-    mcm = 0;
-    for (int i = 0; i < nrNodes; i++)
-        if (mcm < chi[i])
-            mcm = chi[i];
+    mcm = solver.maximumCycleMean(mcmGraph);
     
     // Cleanup
-    delete [] IJ;
-    delete [] A;
-    delete [] v;
-    delete [] chi;
-    delete [] policy;
+    for (MCMgraphsIter iter = components.begin();
+            iter != components.end(); iter++)
+    {
+        delete *iter;
+    }
     delete mcmGraph;
     
     return mcm;
@@ -644,22 +569,27 @@ CFraction mcmHoward(TimedSDFgraph *g)
 /**
  * maximumCycleMeanHoward ()
  * The function computes the maximum cycle mean of a HSDF graph using Howard's
- * algorithm.
+ * algorithm. The workspace of the given solver is used, so repeated calls with
+ * the same solver do not allocate memory for the algorithm.
  */
-CFraction maximumCycleMeanHoward(TimedSDFgraph *g)
+CFraction maximumCycleMeanHoward(TimedSDFgraph *g, MCMhoward &solver)
 {
     CFraction mcmGraph;
     
-    // Check that graph g is an HSDF graph
-    if (!isHSDFgraph(g))
-        throw CException("Graph is not an HSDF graph.");    
-
-    // Check that the graph g is a strongly connected graph
-    if (!isStronglyConnectedGraph(g))
-        throw CException("Graph is not strongly connected.");
-        
-    mcmGraph = mcmHoward(g);
+    mcmGraph = mcmHoward(g, solver);
     
     return mcmGraph;
 }
 
+
+/**
+ * maximumCycleMeanHoward ()
+ * The function computes the maximum cycle mean of a HSDF graph using Howard's
+ * algorithm.
+ */
+CFraction maximumCycleMeanHoward(TimedSDFgraph *g)
+{
+    MCMhoward solver;
+    
+    return maximumCycleMeanHoward(g, solver);
+}
@@ -0,0 +1,125 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   mcmhoward.h
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 17, 2026
+ *
+ *  Function        :   Compute the MCM for an HSDF graph using Howard's
+ *                      algorithm implemented in Max-Plus algebra.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+#ifndef SDF_ANALYSIS_MCM_MCMHOWARD_H_INCLUDED
+#define SDF_ANALYSIS_MCM_MCMHOWARD_H_INCLUDED
+
+#include "mcmgraph.h"
+
+/**
+ * MCMhoward
+ * Howard's policy iteration algorithm for max-plus matrices. All state of the
+ * algorithm is kept in the object, so different objects can be used at the
+ * same time from different threads. The workspace of the algorithm is sized
+ * to the largest graph seen so far and reused by later calls. A solver which
+ * is used repeatedly therefore does not allocate memory once it has seen the
+ * largest graph.
+ */
+class MCMhoward
+{
+public:
+    // Constructor
+    MCMhoward();
+
+    // Destructor
+    ~MCMhoward() {};
+
+    // Maximum cycle mean of a strongly connected MCM graph
+    CFraction maximumCycleMean(MCMgraph *g);
+
+    // Howard's algorithm on a sparse max-plus matrix
+    void solve(const int *IJ, const double *A, const int NNODES,
+            const int NARCS, double *CHI, double *V, int *POLICY,
+            int &NITERATIONS, int &NCOMPONENTS);
+
+private:
+    // Workspace
+    void reserve(const int NNODES, const int NARCS);
+
+    // Steps of the algorithm
+    void Epsilon();
+    void Initial_Policy();
+    void New_Build_Inverse();
+    void Init_Depth_First();
+    void New_Depth_First_Label(int i);
+    void Visit_From(int initialpoint, int color);
+    void Value();
+    void Init_Improve();
+    void First_Order_Improvement(int *improved);
+    void Second_Order_Improvement(int *improved);
+    void Improve(int *improved);
+    void Check_Rows();
+    void Security_Check();
+    void Update_Policy();
+
+    // Arguments of the algorithm
+    const int *ij;
+    const double *a;
+    int nnodes;
+    int narcs;
+    double *chi;
+    double *v;
+    int *pi;
+    int *NComponents;
+
+    // New policy
+    vector<int> newpi;
+
+    // The inverse policy is coded by a linearly chained list.
+    // piinv_idx[i]= pointer to the chain of inverses of node i.
+    // piinv_succ[j]= pointer to the next inverse
+    // piinv_elem[j]= corresponding node
+    // piinv_last[i]= last inverse of i
+    vector<int> piinv_idx;
+    vector<int> piinv_succ;
+    vector<int> piinv_elem;
+    vector<int> piinv_last;
+
+    vector<double> c;
+    vector<double> vaux;
+    vector<double> newc;
+    vector<double> newchi;
+    vector<int> visited;
+    vector<int> component;
+    double lambda;
+    double epsilon;
+    int color;
+
+    // Sparse matrix and result of an MCM graph
+    vector<int> graphIJ;
+    vector<double> graphA;
+    vector<double> graphV;
+    vector<double> graphChi;
+    vector<int> graphPolicy;
+    MCMgraphCSR csr;
+};
+
+#endif
@@ -41,23 +41,115 @@
 #define MIN(a,b)    ((a)<(b) ? (a) : (b))
 #define MAX(a,b)    ((a)>(b) ? (a) : (b))
 
+// Maximal size (in bytes) of the distance matrix which is kept in memory
+#define KARP_MAX_MATRIX_SIZE    (64 << 20)
+
+// Minimal number of edges for which a level is relaxed in parallel. Smaller
+// levels are relaxed faster than the workers can be woken up.
+#define KARP_MIN_PARALLEL_EDGES 65536
+
+/**
+ * KarpLevel
+ * Relaxation of a single level of Karp's algorithm. The distances of the
+ * previous level are read from prev and the distances of the nodes
+ * [first, last) of the current level are written to cur.
+ */
+typedef struct _KarpLevel
+{
+    const MCMgraphCSR *g;
+    const int *prev;
+    int *cur;
+    uint nrJobs;
+} KarpLevel;
+
+/**
+ * relaxKarpNodes ()
+ * The function computes the distances of the nodes [first, last) in the
+ * current level.
+ */
+static
+void relaxKarpNodes(const MCMgraphCSR &g, const int *prev, int *cur,
+        const uint first, const uint last)
+{
+    for (uint v = first; v < last; v++)
+    {
+        int dv = -INT_MAX;
+        
+        for (uint e = g.inIdx[v]; e < g.inIdx[v+1]; e++)
+            dv = MAX(dv, prev[g.src[e]] + g.w[e]);
+        
+        cur[v] = dv;
+    }
+}
+
+/**
+ * relaxKarpJob ()
+ * The function relaxes one slice of the nodes of a level. The slices have
+ * (roughly) the same number of nodes.
+ */
+static
+void relaxKarpJob(void *arg, const CSize job, const uint thread)
+{
+    KarpLevel *l = (KarpLevel*)arg;
+    uint n = l->g->nrNodes();
+    
+    relaxKarpNodes(*l->g, l->prev, l->cur, (uint)((job * n) / l->nrJobs),
+            (uint)(((job + 1) * n) / l->nrJobs));
+}
+
+/**
+ * relaxKarpLevel ()
+ * The function computes the distances cur of level k from the distances prev
+ * of level k-1. Large levels are divided over nrThreads threads.
+ */
+static
+void relaxKarpLevel(const MCMgraphCSR &g, const int *prev, int *cur,
+        const uint nrThreads)
+{
+    KarpLevel l;
+    
+    if (nrThreads < 2 || g.nrEdges() < KARP_MIN_PARALLEL_EDGES)
+    {
+        relaxKarpNodes(g, prev, cur, 0, g.nrNodes());
+        return;
+    }
+    
+    l.g = &g;
+    l.prev = prev;
+    l.cur = cur;
+    l.nrJobs = nrThreads;
+    runParallelJobs(relaxKarpJob, &l, nrThreads, nrThreads);
+}
+
 /**
  * mcmKarp ()
  * The function computes the maximum cycle mean of a HSDF graph using Karp's
- * algorithm.
+ * algorithm. The distances D_k(v) of all levels k are needed twice: once to
+ * find D_n(v) and once to evaluate Karp's theorem
+ *
+ *     mcm = max_v min_k (D_n(v) - D_k(v)) / (n - k)
+ *
+ * When the (n+1) x n distance matrix is small, all levels are stored in the
+ * forward pass. Otherwise only two levels are kept and the levels are
+ * recomputed in a second pass, which bounds the memory to O(n). The minimum
+ * for every node is kept as an exact fraction, so both ways give the same
+ * result.
  */
 static
-CFraction mcmKarp(TimedSDFgraph *g)
+CFraction mcmKarp(TimedSDFgraph *g, const uint nrThreads)
 {
     MCMgraphs components;
     MCMgraph *mcmGraph;
-    int k, n;
-    int **d;
-    double l, ld;
-    MCMnode *u;
+    MCMgraphCSR csr;
+    uint k, n;
+    bool storeLevels;
+    vector<int> levels, dn, minNum, minDen;
+    int *prev, *cur;
+    uint u;
+    int d;
     
-    // Transform the HSDF to a weighted directed graph
-    mcmGraph = transformHSDFtoMCMgraph(g);
+    // Transform the (H)SDF graph to a weighted directed graph
+    mcmGraph = transformSDFtoMCMgraph(g);
 
     // Extract the strongly connected component from the graph
     // According to the Max-Plus book there is exactly one strongly
@@ -65,81 +157,112 @@ CFraction mcmKarp(TimedSDFgraph *g)
     // connected (H)SDF graph.
     stronglyConnectedMCMgraph(mcmGraph, components);
 
-    // Remove all hidden edges and nodes from the graph and assign new id's
-    relabelMCMgraph(mcmGraph);
+    // Compressed sparse row representation of the visible part of the graph
+    csr.init(mcmGraph);
+
+    // Cleanup
+    for (MCMgraphsIter iter = components.begin();
+            iter != components.end(); iter++)
+    {
+        delete *iter;
+    }
+    delete mcmGraph;
 
     // Allocate memory
-    n = mcmGraph->nrNodes();
-    d = new int* [n+1];
-    for (int i = 0; i < n+1; i++)
-        d[i] = new int [n];
+    n = csr.nrNodes();
+    storeLevels = ((double)(n+1) * n * sizeof(int) <= KARP_MAX_MATRIX_SIZE);
+    levels.resize(storeLevels ? (n+1) * n : 2 * n);
+    dn.resize(n);
+    minNum.resize(n);
+    minDen.resize(n);
 
-    // Initialize
+    // Forward pass: compute the distances D_1(v) up to D_n(v)
+    prev = cur = NULL;
+    for (uint v = 0; v < n; v++)
+        levels[v] = 0;
     for (k = 1; k < n+1; k++)
-        for (int u = 0; u < n; u++)
-            d[k][u] = -INT_MAX;
-    for (int u = 0; u < n; u++)
-        d[0][u] = 0;
+    {
+        if (storeLevels)
+        {
+            prev = &levels[(k-1) * n];
+            cur = &levels[k * n];
+        }
+        else
+        {
+            prev = &levels[((k-1) % 2) * n];
+            cur = &levels[(k % 2) * n];
+        }
+        
+        relaxKarpLevel(csr, prev, cur, nrThreads);
+    }
+    for (uint v = 0; v < n; v++)
+        dn[v] = cur[v];
     
-    // Compute the distances
-    for (k = 1; k < n+1; k++)
+    // Evaluate Karp's theorem for all levels k in [0, n)
+    for (k = 0; k < n; k++)
     {
-        for (MCMnodesIter iter = mcmGraph->nodes.begin();
-                iter != mcmGraph->nodes.end(); iter++)
+        if (storeLevels)
+        {
+            cur = &levels[k * n];
+        }
+        else
         {
-            MCMnode *v = *iter;
+            prev = &levels[((k+1) % 2) * n];
+            cur = &levels[(k % 2) * n];
             
-            for (MCMedgesIter e = v->in.begin();
-                e != v->in.end(); e++)
+            if (k == 0)
             {
-                MCMnode *u = (*e)->src;
-                
-                d[k][v->id] = MAX(d[k][v->id], d[k-1][u->id] + (*e)->w);
+                for (uint v = 0; v < n; v++)
+                    cur[v] = 0;
+            }
+            else
+            {
+                relaxKarpLevel(csr, prev, cur, nrThreads);
+            }
+        }
+        
+        for (uint v = 0; v < n; v++)
+        {
+            int num = dn[v] - cur[v];
+            int den = n - k;
+            
+            // (num / den) smaller then current minimum of v?
+            if (k == 0 || (long long)num * minDen[v]
+                            < (long long)minNum[v] * den)
+            {
+                minNum[v] = num;
+                minDen[v] = den;
             }
         }
     }
     
     // Compute lamda using Karp's theorem
-    l = -INT_MAX;
-    for (MCMnodesIter iter = mcmGraph->nodes.begin();
-            iter != mcmGraph->nodes.end(); iter++)
+    if (n == 0)
+        return CFraction(-INT_MAX, 1);
+    
+    u = 0;
+    for (uint v = 1; v < n; v++)
     {
-        u = *iter;
-        ld = INT_MAX;
-        for (k = 0; k < n; k++)
-        {
-            ld = MIN(ld, (double)(d[n][u->id]-d[k][u->id]) / (double)(n-k));
-        }
-        l = MAX(l, ld);
+        if ((long long)minNum[v] * minDen[u] > (long long)minNum[u] * minDen[v])
+            u = v;
     }
-
-    // Cleanup
-    delete mcmGraph;
-    for (int i = 0; i < n+1; i++)
-        delete [] d[i];
-    delete [] d;
     
-    return CFraction(l);
+    // Exact fraction in its lowest terms
+    d = gcd(abs(minNum[u]), minDen[u]);
+    
+    return CFraction(minNum[u] / d, minDen[u] / d);
 }
 
 /**
  * maximumCycleMeanKarp ()
  * The function computes the maximum cycle mean of a HSDF graph using Karp's
- * algorithm.
+ * algorithm. The relaxation of large levels is divided over nrThreads threads.
  */
-CFraction maximumCycleMeanKarp(TimedSDFgraph *g)
+CFraction maximumCycleMeanKarp(TimedSDFgraph *g, const uint nrThreads)
 {
     CFraction mcmGraph;
     
-    // Check that graph g is an HSDF graph
-    if (!isHSDFgraph(g))
-        throw CException("Graph is not an HSDF graph.");    
-
-    // Check that the graph g is a strongly connected graph
-    if (!isStronglyConnectedGraph(g))
-        throw CException("Graph is not strongly connected.");
-
-    mcmGraph = mcmKarp(g);
+    mcmGraph = mcmKarp(g, nrThreads);
     
     return mcmGraph;
 }
@@ -643,22 +643,20 @@ void mmcycle (graph *gr, double *lambda, arc **cycle, long *len)
  * to graph input for Young-Tarjan-Orlin's algorithm.
  */
 static
-void convertMCMgraphToYTOgraph(MCMgraph *g, graph *gr)
+void convertMCMgraphToYTOgraph(MCMgraphCSR &g, graph *gr)
 {
     node *x;
     arc *a;
 
-    gr->n_nodes = g->nrNodes();
-    gr->n_arcs = g->nrEdges();
+    gr->n_nodes = g.nrNodes();
+    gr->n_arcs = g.nrEdges();
     gr->nodes = (node*)malloc((gr->n_nodes+1)*sizeof(node));
     gr->arcs = (arc*)malloc((gr->n_arcs+gr->n_nodes)*sizeof(arc));
 
     x = gr->nodes;
-    for (MCMnodesIter iter = g->nodes.begin(); iter != g->nodes.end(); iter++)
+    for (uint n = 0; n < g.nrNodes(); n++)
     {
-        MCMnode *n = *iter;
-        
-        x->id = n->id + 1;
+        x->id = n + 1;
         x->first_arc_out = NULL;
         x->first_arc_in = NULL;
         
@@ -667,19 +665,15 @@ void convertMCMgraphToYTOgraph(MCMgraph *g, graph *gr)
     }
     
     a = gr->arcs;
-    for (MCMedgesIter iter = g->edges.begin(); iter != g->edges.end(); iter++)
+    for (uint e = 0; e < g.nrEdges(); e++)
     {
-        MCMedge *e = *iter;
-        MCMnode *u = e->src;
-        MCMnode *v = e->dst;
-
-        //if (u->id == v->id)
+        //if (g.src[e] == g.dst[e])
         //    throw CException("Loop on node in input graph.");
 
-        a->tail = &(gr->nodes[u->id]);
-        a->head = &(gr->nodes[v->id]);
-        a->cost = e->w;
-        a->transit_time = e->d;
+        a->tail = &(gr->nodes[g.src[e]]);
+        a->head = &(gr->nodes[g.dst[e]]);
+        a->cost = g.w[e];
+        a->transit_time = g.d[e];
         a->next_out = a->tail->first_arc_out;
         a->tail->first_arc_out = a;
         a->next_in = a->head->first_arc_in;
@@ -711,21 +705,15 @@ void convertMCMgraphToYTOgraph(MCMgraph *g, graph *gr)
 
 #if 0
     // Print the MCM graph
-    cerr << "#nodes: " << g->nodes.size() << endl;
-    cerr << "#edges: " << g->edges.size() << endl;
+    cerr << "#nodes: " << g.nrNodes() << endl;
+    cerr << "#edges: " << g.nrEdges() << endl;
     cerr << "edge: (u, v, w, d)" << endl;
-    for (MCMedgesIter iter = g->edges.begin();
-            iter != g->edges.end(); iter++)
+    for (uint e = 0; e < g.nrEdges(); e++)
     {
-        MCMedge *e = *iter;
-        
-        if (!e->visible)
-            continue;
-
-        cerr << "(" << e->src->id;
-        cerr << ", " << e->dst->id;
-        cerr << ", " << e->w;
-        cerr << ", " << e->d;
+        cerr << "(" << g.src[e];
+        cerr << ", " << g.dst[e];
+        cerr << ", " << g.w[e];
+        cerr << ", " << g.d[e];
         cerr << ")" << endl;
     }
     cerr << endl;
@@ -763,10 +751,11 @@ CFraction mcmYoungTarjanOrlin(TimedSDFgraph *g, bool mcmFormulation)
     double mcm;
     MCMgraphs components;
     MCMgraph *mcmGraph;
+    MCMgraphCSR csr;
     graph ytoGraph;
     
-    // Transform the HSDF to a weighted directed graph
-    mcmGraph = transformHSDFtoMCMgraph(g, mcmFormulation);
+    // Transform the (H)SDF graph to a weighted directed graph
+    mcmGraph = transformSDFtoMCMgraph(g, mcmFormulation);
 
     // Extract the strongly connected component from the graph
     // According to the Max-Plus book there is exactly one strongly
@@ -774,16 +763,21 @@ CFraction mcmYoungTarjanOrlin(TimedSDFgraph *g, bool mcmFormulation)
     // connected (H)SDF graph.
     stronglyConnectedMCMgraph(mcmGraph, components);
 
-    // Remove all hidden edges and nodes from the graph and assign new id's
-    relabelMCMgraph(mcmGraph);
+    // Compressed sparse row representation of the visible part of the graph
+    csr.init(mcmGraph);
 
     // Convert the graph to an input graph for the YTO algorithm
-    convertMCMgraphToYTOgraph(mcmGraph, &ytoGraph);
+    convertMCMgraphToYTOgraph(csr, &ytoGraph);
 
     // Find maximum cycle mean
     mmcycle(&ytoGraph, &mcm, NULL, NULL);
 
     // Cleanup
+    for (MCMgraphsIter iter = components.begin();
+            iter != components.end(); iter++)
+    {
+        delete *iter;
+    }
     delete mcmGraph;
     free(ytoGraph.nodes);
     free(ytoGraph.arcs);
@@ -800,14 +794,6 @@ CFraction maximumCycleYoungTarjanOrlin(TimedSDFgraph *g, bool mcmFormulation)
 {
     CFraction mcmGraph;
     
-    // Check that graph g is an HSDF graph
-    if (!isHSDFgraph(g))
-        throw CException("Graph is not an HSDF graph.");    
-
-    // Check that the graph g is a strongly connected graph
-    if (!isStronglyConnectedGraph(g))
-        throw CException("Graph is not strongly connected.");
-        
     mcmGraph = mcmYoungTarjanOrlin(g, mcmFormulation);
     
     return mcmGraph;
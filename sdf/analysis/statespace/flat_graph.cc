@@ -0,0 +1,137 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   flat_graph.cc
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 17, 2026
+ *
+ *  Function        :   Flat execution model of a timed SDF graph
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+#include "flat_graph.h"
+#include "../../base/algo/repetition_vector.h"
+
+/**
+ * compile ()
+ * The function compiles the ports, channels and repetition vector of the
+ * graph into the flat model. The execution times of all actors are zero. An
+ * exception is thrown when the ids of the actors or channels are not numbered
+ * from zero.
+ */
+void SDFflatGraph::compile(SDFgraph *g)
+{
+    vector<SDFactor*> actors(g->nrActors(), (SDFactor*)NULL);
+
+    // The flat model is indexed on the ids of the actors and channels
+    for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
+    {
+        SDFactor *a = *iter;
+
+        if (a->getId() >= g->nrActors() || actors[a->getId()] != NULL)
+            throw CException("Graph '" + g->getName()
+                    + "' has actor ids that are not numbered from zero.");
+
+        actors[a->getId()] = a;
+    }
+    for (SDFchannelsIter iter = g->channelsBegin();
+            iter != g->channelsEnd(); iter++)
+    {
+        if ((*iter)->getId() >= g->nrChannels())
+            throw CException("Graph '" + g->getName()
+                    + "' has channel ids that are not numbered from zero.");
+    }
+
+    inPos.resize(g->nrActors() + 1);
+    outPos.resize(g->nrActors() + 1);
+    inCh.clear();
+    inRt.clear();
+    outCh.clear();
+    outRt.clear();
+
+    // Ports of the actors in the order of their ids
+    for (uint a = 0; a < g->nrActors(); a++)
+    {
+        SDFactor *actor = actors[a];
+
+        inPos[a] = inCh.size();
+        outPos[a] = outCh.size();
+
+        for (SDFportsIter iter = actor->portsBegin(); 
+                iter != actor->portsEnd(); iter++)
+        {
+            SDFport *p = *iter;
+
+            if (p->getType() == SDFport::In)
+            {
+                inCh.push_back(p->getChannel()->getId());
+                inRt.push_back(p->getRate());
+            }
+            else
+            {
+                outCh.push_back(p->getChannel()->getId());
+                outRt.push_back(p->getRate());
+            }
+        }
+    }
+    inPos[g->nrActors()] = inCh.size();
+    outPos[g->nrActors()] = outCh.size();
+
+    // Channels
+    chSrc.resize(g->nrChannels());
+    chDst.resize(g->nrChannels());
+    chSrcRt.resize(g->nrChannels());
+    chDstRt.resize(g->nrChannels());
+    chTokens.resize(g->nrChannels());
+    for (SDFchannelsIter iter = g->channelsBegin(); 
+            iter != g->channelsEnd(); iter++)
+    {
+        SDFchannel *c = *iter;
+
+        chSrc[c->getId()] = c->getSrcActor()->getId();
+        chDst[c->getId()] = c->getDstActor()->getId();
+        chSrcRt[c->getId()] = c->getSrcPort()->getRate();
+        chDstRt[c->getId()] = c->getDstPort()->getRate();
+        chTokens[c->getId()] = c->getInitialTokens();
+    }
+
+    // Actors
+    execTime.assign(g->nrActors(), 0);
+    repVec = computeRepetitionVector(g);
+}
+
+/**
+ * compile ()
+ * The function compiles the timed graph into the flat model. The execution
+ * time of an actor is its execution time on its default processor.
+ */
+void SDFflatGraph::compile(TimedSDFgraph *g)
+{
+    compile((SDFgraph*)(g));
+
+    for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
+    {
+        TimedSDFactor *a = (TimedSDFactor*)(*iter);
+
+        execTime[a->getId()] = a->getExecutionTime();
+    }
+}
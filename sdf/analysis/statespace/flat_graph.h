@@ -0,0 +1,110 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   flat_graph.h
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 17, 2026
+ *
+ *  Function        :   Flat execution model of a timed SDF graph
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+#ifndef SDF_ANALYSIS_STATESPACE_FLAT_GRAPH_H_INCLUDED
+#define SDF_ANALYSIS_STATESPACE_FLAT_GRAPH_H_INCLUDED
+
+#include "../../base/timed/graph.h"
+
+/**
+ * SDFflatGraph
+ * Execution model of an SDF graph in which all information needed to execute
+ * the graph is compiled into flat arrays. The input ports of actor a are found
+ * at the positions inBegin(a) till inEnd(a) and its output ports at the
+ * positions outBegin(a) till outEnd(a). Every port position gives the id of
+ * the channel connected to the port and the rate of the port. Actors and
+ * channels are identified through their ids, which must be numbered from zero.
+ * The transition systems of the state-space analyses use this model in their
+ * inner loops instead of walking the ports and channels of the graph.
+ */
+class SDFflatGraph
+{
+public:
+    // Constructor
+    SDFflatGraph() {};
+    SDFflatGraph(SDFgraph *g) { compile(g); };
+    SDFflatGraph(TimedSDFgraph *g) { compile(g); };
+
+    // Destructor
+    ~SDFflatGraph() {};
+
+    // Compile the graph into the flat model
+    void compile(SDFgraph *g);
+    void compile(TimedSDFgraph *g);
+
+    // Size of the graph
+    uint nrActors() const { return execTime.size(); };
+    uint nrChannels() const { return chSrc.size(); };
+
+    // Input ports of an actor
+    uint inBegin(const CId a) const { return inPos[a]; };
+    uint inEnd(const CId a) const { return inPos[a+1]; };
+    CId inChannel(const uint p) const { return inCh[p]; };
+    SDFrate inRate(const uint p) const { return inRt[p]; };
+
+    // Output ports of an actor
+    uint outBegin(const CId a) const { return outPos[a]; };
+    uint outEnd(const CId a) const { return outPos[a+1]; };
+    CId outChannel(const uint p) const { return outCh[p]; };
+    SDFrate outRate(const uint p) const { return outRt[p]; };
+
+    // Channels
+    CId srcActor(const CId c) const { return chSrc[c]; };
+    CId dstActor(const CId c) const { return chDst[c]; };
+    SDFrate srcRate(const CId c) const { return chSrcRt[c]; };
+    SDFrate dstRate(const CId c) const { return chDstRt[c]; };
+    uint initialTokens(const CId c) const { return chTokens[c]; };
+
+    // Actors (execution times are only known for a timed graph)
+    SDFtime executionTime(const CId a) const { return execTime[a]; };
+    int repetitions(const CId a) const { return repVec[a]; };
+
+private:
+    // Ports
+    vector<uint> inPos;
+    vector<CId> inCh;
+    vector<SDFrate> inRt;
+    vector<uint> outPos;
+    vector<CId> outCh;
+    vector<SDFrate> outRt;
+
+    // Channels
+    vector<CId> chSrc;
+    vector<CId> chDst;
+    vector<SDFrate> chSrcRt;
+    vector<SDFrate> chDstRt;
+    vector<uint> chTokens;
+
+    // Actors
+    vector<SDFtime> execTime;
+    vector<int> repVec;
+};
+
+#endif
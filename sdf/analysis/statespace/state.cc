@@ -0,0 +1,237 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   state.cc
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 17, 2026
+ *
+ *  Function        :   Compact storage of states in a transition system
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+#include "state.h"
+
+// Initial number of slots in the index of stored states (power of two)
+#define STATE_INDEX_INIT_SIZE   1024
+
+/******************************************************************************
+ * SDFcompactState
+ *****************************************************************************/
+
+/**
+ * pushWord ()
+ * The function appends the value v to the encoding. An exception is thrown
+ * when v does not fit into a single word.
+ */
+void SDFcompactState::pushWord(const unsigned long long v)
+{
+    if (v > SDFSTATEWORD_MAX)
+        throw CException("State value exceeds the range of a state word.");
+
+    words.push_back((SDFstateWord)v);
+}
+
+/**
+ * pushLong ()
+ * The function appends the value v to the encoding using two words. The least
+ * significant word is stored first.
+ */
+void SDFcompactState::pushLong(const unsigned long long v)
+{
+    words.push_back((SDFstateWord)(v & SDFSTATEWORD_MAX));
+    words.push_back((SDFstateWord)(v >> 32));
+}
+
+/**
+ * pushClocks ()
+ * The function appends the remaining execution times of the active firings of
+ * an actor to the encoding. The number of active firings is stored in front of
+ * the times, so that the encodings of two states only have the same words when
+ * all actors have the same active firings.
+ */
+void SDFcompactState::pushClocks(const list<SDFtime> &clk)
+{
+    words.push_back((SDFstateWord)clk.size());
+
+    for (list<SDFtime>::const_iterator iter = clk.begin();
+            iter != clk.end(); iter++)
+    {
+        words.push_back((SDFstateWord)(*iter));
+    }
+}
+
+/**
+ * pushClocks ()
+ * The function appends the remaining execution times of the active firings of
+ * an actor to the encoding. An exception is thrown when a time does not fit
+ * into a single word.
+ */
+void SDFcompactState::pushClocks(const list<unsigned long long> &clk)
+{
+    words.push_back((SDFstateWord)clk.size());
+
+    for (list<unsigned long long>::const_iterator iter = clk.begin();
+            iter != clk.end(); iter++)
+    {
+        pushWord(*iter);
+    }
+}
+
+/**
+ * hashKey ()
+ * The function returns a hash key of the encoding. The key is built
+ * incrementally (FNV-1a style) over all words of the key of the state.
+ */
+SDFstateKey SDFcompactState::hashKey() const
+{
+    SDFstateKey key = 14695981039346656037ULL;
+
+    for (uint i = 0; i < getKeyLength(); i++)
+        key = (key ^ words[i]) * 1099511628211ULL;
+
+    // Spread the entropy over the low order bits used by the index
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+
+    return key;
+}
+
+/******************************************************************************
+ * SDFstateStore
+ *****************************************************************************/
+
+/**
+ * clear ()
+ * The function removes all states from the store and resets the index on
+ * these states. The memory of the arena is kept for later use.
+ */
+void SDFstateStore::clear()
+{
+    SDFstateSlot empty;
+
+    arena.reset();
+    states.clear();
+
+    empty.key = 0;
+    empty.pos = SDFSTATEPOS_NONE;
+    index.assign(STATE_INDEX_INIT_SIZE, empty);
+}
+
+/**
+ * growIndex ()
+ * The function doubles the number of slots in the index of stored states and
+ * re-inserts all states into the enlarged index.
+ */
+void SDFstateStore::growIndex()
+{
+    vector<SDFstateSlot> oldIndex;
+    SDFstateSlot empty;
+    size_t mask;
+
+    empty.key = 0;
+    empty.pos = SDFSTATEPOS_NONE;
+
+    oldIndex.swap(index);
+    index.assign(2 * oldIndex.size(), empty);
+    mask = index.size() - 1;
+
+    for (size_t i = 0; i < oldIndex.size(); i++)
+    {
+        SDFstateSlot &slot = oldIndex[i];
+        size_t j;
+
+        if (slot.pos == SDFSTATEPOS_NONE)
+            continue;
+
+        // Linear probing for a free slot
+        for (j = slot.key & mask; index[j].pos != SDFSTATEPOS_NONE;
+                j = (j + 1) & mask);
+
+        index[j] = slot;
+    }
+}
+
+/**
+ * store ()
+ * The function stores the state s whenever s is not already in the store. When
+ * s is stored, the function returns true. When a state with the same key is
+ * already in the store, the state s is not stored and the function returns
+ * false. The function always sets pos to the position of the state s in the
+ * store.
+ */
+bool SDFstateStore::store(const SDFcompactState &s, SDFstatePos &pos)
+{
+    SDFstateKey key = s.hashKey();
+    size_t mask = index.size() - 1;
+    uint len = s.getLength();
+    uint keyLen = s.getKeyLength();
+    SDFstateWord *w;
+    size_t i;
+
+    // Find state in the index of stored states
+    for (i = key & mask; index[i].pos != SDFSTATEPOS_NONE; i = (i + 1) & mask)
+    {
+        SDFstateSlot &slot = index[i];
+
+        // State s stored at this slot of the index?
+        if (slot.key == key && getKeyLength(slot.pos) == keyLen
+                && (keyLen == 0 || memcmp(getState(slot.pos), s.getWords(),
+                            keyLen * sizeof(SDFstateWord)) == 0))
+        {
+            pos = slot.pos;
+            return false;
+        }
+    }
+
+    // State not found, place it in the arena
+    w = arena.allocArray<SDFstateWord>(len + 2);
+    w[0] = len;
+    w[1] = keyLen;
+    if (len > 0)
+        memcpy(w + 2, s.getWords(), len * sizeof(SDFstateWord));
+    pos = states.size();
+    states.push_back(w);
+
+    // Add the state to the index
+    index[i].key = key;
+    index[i].pos = pos;
+
+    // Keep the load of the index below one half
+    if (2 * states.size() > index.size())
+        growIndex();
+
+    return true;
+}
+
+/**
+ * getLong ()
+ * The function returns the value which is stored with pushLong at the given
+ * word offset of the state at position pos.
+ */
+unsigned long long SDFstateStore::getLong(const SDFstatePos pos,
+        const uint offset) const
+{
+    const SDFstateWord *w = getState(pos) + offset;
+
+    return (unsigned long long)w[0] | ((unsigned long long)w[1] << 32);
+}
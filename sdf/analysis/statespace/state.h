@@ -0,0 +1,170 @@
+/*
+ *  TU Eindhoven
+ *  Eindhoven, The Netherlands
+ *
+ *  Name            :   state.h
+ *
+ *  Author          :   agent (agent@local)
+ *
+ *  Date            :   October 17, 2026
+ *
+ *  Function        :   Compact storage of states in a transition system
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ *
+ * In other words, you are welcome to use, share and improve this program.
+ * You are forbidden to forbid anyone else to use, share and improve
+ * what you give them.   Happy coding!
+ */
+
+#ifndef SDF_ANALYSIS_STATESPACE_STATE_H_INCLUDED
+#define SDF_ANALYSIS_STATESPACE_STATE_H_INCLUDED
+
+#include "../../base/timed/graph.h"
+
+// Word in the encoding of a state
+typedef uint SDFstateWord;
+
+// Hash key of an encoded state
+typedef unsigned long long SDFstateKey;
+
+// Position of a state in a state store
+typedef unsigned long SDFstatePos;
+
+#define SDFSTATEWORD_MAX    UINT_MAX
+#define SDFSTATEPOS_NONE    ULONG_MAX
+
+/**
+ * SDFcompactState
+ * Flat encoding of a state of a transition system. All information of the
+ * state (channel fills, remaining execution times of the active actor firings,
+ * schedule positions, ...) is written as a sequence of fixed-width words into
+ * one contiguous array. The leading words form the key of the state. Two
+ * encoded states are equal iff their keys are equal, which allows a memcmp
+ * based comparison. Words written after endKey() are a payload which is
+ * stored with the state, but which is not used to identify it. The hash key
+ * of the encoding is computed once when the state is stored.
+ */
+class SDFcompactState
+{
+public:
+    // Constructor
+    SDFcompactState() { clear(); };
+
+    // Destructor
+    ~SDFcompactState() {};
+
+    // Remove all words from the encoding
+    void clear() { words.clear(); keyLength = 0; hasPayload = false; };
+
+    // All following words are payload
+    void endKey() { keyLength = words.size(); hasPayload = true; };
+
+    // Append a value which fits in a single word
+    void pushWord(const unsigned long long v);
+
+    // Append a value which may require two words
+    void pushLong(const unsigned long long v);
+
+    // Append the remaining execution times of the firings of an actor
+    void pushClocks(const list<SDFtime> &clk);
+    void pushClocks(const list<unsigned long long> &clk);
+
+    // Access to the encoding
+    const SDFstateWord *getWords() const {
+        return words.empty() ? NULL : &words[0];
+    };
+    uint getLength() const { return words.size(); };
+    uint getKeyLength() const {
+        return hasPayload ? keyLength : words.size();
+    };
+
+    // Hash key of the encoding
+    SDFstateKey hashKey() const;
+
+private:
+    vector<SDFstateWord> words;
+    uint keyLength;
+    bool hasPayload;
+};
+
+/**
+ * SDFstateStore
+ * Set of encoded states. The states are kept in the order in which they are
+ * stored, so the position of a state identifies it for its lifetime in the
+ * store. The words of all states are placed back to back in an arena, in
+ * which each state is preceded by its length and the length of its key. The
+ * arena is reset when the store is cleared, so repeated explorations reuse
+ * the same memory. States are located through an open addressing hash index
+ * on the precomputed hash keys.
+ */
+class SDFstateStore
+{
+public:
+    // Constructor
+    SDFstateStore() { clear(); };
+
+    // Destructor
+    ~SDFstateStore() {};
+
+    // Remove all states from the store
+    void clear();
+
+    // Store state (returns true when the state was not yet in the store)
+    bool store(const SDFcompactState &s, SDFstatePos &pos);
+
+    // Number of stored states
+    SDFstatePos size() const { return states.size(); };
+
+    // Access to the encoding of a stored state
+    const SDFstateWord *getState(const SDFstatePos pos) const {
+        return states[pos] + 2;
+    };
+    uint getLength(const SDFstatePos pos) const {
+        return states[pos][0];
+    };
+    uint getKeyLength(const SDFstatePos pos) const {
+        return states[pos][1];
+    };
+
+    // Access to the payload of a stored state
+    const SDFstateWord *getPayload(const SDFstatePos pos) const {
+        return getState(pos) + getKeyLength(pos);
+    };
+
+    // Value stored with pushLong at the given word offset of a state
+    unsigned long long getLong(const SDFstatePos pos, const uint offset) const;
+
+private:
+    // Slot in the index of stored states
+    typedef struct _SDFstateSlot
+    {
+        SDFstateKey key;
+        SDFstatePos pos;
+    } SDFstateSlot;
+
+    // Index of stored states
+    void growIndex();
+
+    // Memory in which the stored states are placed
+    CArena arena;
+
+    // Location of every stored state in the arena
+    vector<SDFstateWord*> states;
+
+    // Open addressing hash index on the stored states
+    vector<SDFstateSlot> index;
+};
+
+#endif
@@ -34,7 +34,6 @@
  */
 
 #include "deadlock.h"
-#include "../../base/algo/repetition_vector.h"
 #include "../../base/algo/components.h"
 
 #define max(a,b) ((a)>(b) ? (a) : (b))
@@ -102,22 +101,13 @@ bool SDFstateSpaceDeadlockAnalysis::TransitionSystem::State::operator==(
  * s. Else it returns false.
  */
 bool SDFstateSpaceDeadlockAnalysis::TransitionSystem::actorReadyToFire(
-        SDFactor *a)
+        const CId a)
 {
     // Check all input ports for tokens
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    for (uint p = flatGraph.inBegin(a); p < flatGraph.inEnd(a); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-        
-        // Actor is destination of the channel?
-        if (p->getType() == SDFport::In)
-        {
-            if (!CH_TOKENS(c->getId(), p->getRate()))
-            {
-                return false;
-            }    
-        }
+        if (!CH_TOKENS(flatGraph.inChannel(p), flatGraph.inRate(p)))
+            return false;
     }
 
     return true;
@@ -128,23 +118,18 @@ bool SDFstateSpaceDeadlockAnalysis::TransitionSystem::actorReadyToFire(
  * Fire an actor. Remove tokens from all input channels and produce tokens on
  * all output channels.
  */
-void SDFstateSpaceDeadlockAnalysis::TransitionSystem::fireActor(SDFactor *a)
+void SDFstateSpaceDeadlockAnalysis::TransitionSystem::fireActor(const CId a)
 {
-    // Consume tokens from inputs and space for output tokens
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    // Consume tokens from inputs
+    for (uint p = flatGraph.inBegin(a); p < flatGraph.inEnd(a); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-        
-        // Actor is destination of the channel?
-        if (p->getType() == SDFport::In)
-        {
-            CONSUME(c->getId(), p->getRate());
-        }
-        else
-        {
-            PRODUCE(c->getId(), p->getRate());
-        }
+        CONSUME(flatGraph.inChannel(p), flatGraph.inRate(p));
+    }
+
+    // Produce tokens on outputs
+    for (uint p = flatGraph.outBegin(a); p < flatGraph.outEnd(a); p++)
+    {
+        PRODUCE(flatGraph.outChannel(p), flatGraph.outRate(p));
     }
 }
 
@@ -155,7 +140,7 @@ void SDFstateSpaceDeadlockAnalysis::TransitionSystem::fireActor(SDFactor *a)
  */  
 bool SDFstateSpaceDeadlockAnalysis::TransitionSystem::execSDFgraph()  
 {
-    RepetitionVector repVec;
+    vector<int> repCnt(flatGraph.nrActors());
     bool firedSomeActor;
     
     // Create initial state
@@ -165,17 +150,15 @@ bool SDFstateSpaceDeadlockAnalysis::TransitionSystem::execSDFgraph()
     currentState.clear();  
 
     // Initial tokens and space
-    for (SDFchannelsIter iter = g->channelsBegin();
-            iter != g->channelsEnd(); iter++)
+    for (uint c = 0; c < flatGraph.nrChannels(); c++)
     {
-        SDFchannel *c = *iter;
-        
-        CH(c->getId()) = c->getInitialTokens();
+        CH(c) = flatGraph.initialTokens(c);
     }
     initialState = currentState;
     
-    // Compute repetition vector
-    repVec = computeRepetitionVector(g);
+    // Number of firings per actor in one iteration
+    for (uint a = 0; a < flatGraph.nrActors(); a++)
+        repCnt[a] = flatGraph.repetitions(a);
     
     // Fire the actors  
     while (true)  
@@ -183,17 +166,14 @@ bool SDFstateSpaceDeadlockAnalysis::TransitionSystem::execSDFgraph()
         firedSomeActor = false;
         
         // Fire actors when possible  
-        for (SDFactorsIter iter = g->actorsBegin();
-                iter != g->actorsEnd(); iter++)
+        for (uint a = 0; a < flatGraph.nrActors(); a++)
         {
-            TimedSDFactor *a = (TimedSDFactor*)(*iter);
-        
             // Ready to fire actor a?
-            while (repVec[a->getId()] != 0 && actorReadyToFire(a))
+            while (repCnt[a] != 0 && actorReadyToFire(a))
             {
                 // Fire actor a
                 fireActor(a);
-                repVec[a->getId()]--;
+                repCnt[a]--;
                 firedSomeActor = true;
             }
         }
@@ -204,7 +184,7 @@ bool SDFstateSpaceDeadlockAnalysis::TransitionSystem::execSDFgraph()
             // All actors fired as often as indicated by repVec
             for (uint i = 0; i < g->nrActors(); i++)
             {
-                if (repVec[i] != 0)
+                if (repCnt[i] != 0)
                     return false;
             }
             
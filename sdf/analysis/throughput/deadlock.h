@@ -37,6 +37,7 @@
 #define SDF_ANALYSIS_STATESPACE_DEADLOCK_H_INCLUDED
 
 #include "../../base/timed/graph.h"
+#include "../statespace/flat_graph.h"
 
 /**
  * Deadlock analysis
@@ -103,6 +104,7 @@ private:
         // Constructor
         TransitionSystem(SDFgraph *gr) {
             g = gr;
+            flatGraph.compile(g);
         };
         
         // Destructor
@@ -113,11 +115,14 @@ private:
         
     private:
         // State transitions
-        bool actorReadyToFire(SDFactor *a);
-        void fireActor(SDFactor *a);
+        bool actorReadyToFire(const CId a);
+        void fireActor(const CId a);
 
         // SDF graph and output actor
         SDFgraph *g;
+
+        // Flat execution model of the graph
+        SDFflatGraph flatGraph;
         
         // Current state
         State initialState;
@@ -55,14 +55,14 @@ void SDFstateSpaceThroughputAnalysis::TransitionSystem::State::print(
 {
     out << "### State ###" << endl;
 
-    for (uint i = 0; i < actClk.size(); i++)
+    for (uint i = 0; i < actEnd.size(); i++)
     {
         out << "actClk[" << i << "] =";
         
-        for (list<SDFtime>::const_iterator iter = actClk[i].begin();
-                iter != actClk[i].end(); iter++)
+        for (std::deque<unsigned long long>::const_iterator 
+                iter = actEnd[i].begin(); iter != actEnd[i].end(); iter++)
         {
-            out << " " << (*iter) << ", ";
+            out << " " << (*iter - time) << ", ";
         }
         
         out << endl;
@@ -82,9 +82,9 @@ void SDFstateSpaceThroughputAnalysis::TransitionSystem::State::print(
  */
 void SDFstateSpaceThroughputAnalysis::TransitionSystem::State::clear()
 {
-    for (uint i = 0; i < actClk.size(); i++)
+    for (uint i = 0; i < actEnd.size(); i++)
     {
-        actClk[i].clear();
+        actEnd[i].clear();
     }
 
     for (uint i = 0; i < ch.size(); i++)
@@ -92,32 +92,36 @@ void SDFstateSpaceThroughputAnalysis::TransitionSystem::State::clear()
         ch[i] = 0;
     }
     
+    time = 0;
     glbClk = 0;
 }
 
 /**
- * operator== ()
- * The function compares to states and returns true if they are equal.
+ * pack ()
+ * The function writes the state into the compact state s. The global clock is
+ * stored at word offset zero. The active firings of every actor are written
+ * as their remaining execution times, so the encoding does not depend on the
+ * absolute time at which the state is reached.
  */
-bool SDFstateSpaceThroughputAnalysis::TransitionSystem::State::operator==(
-    const State &s)
+void SDFstateSpaceThroughputAnalysis::TransitionSystem::State::pack(
+        SDFcompactState &s) const
 {
-    if (glbClk != s.glbClk)
-        return false;
-    
+    s.clear();
+    s.pushLong(glbClk);
+
     for (uint i = 0; i < ch.size(); i++)
+        s.pushWord(ch[i]);
+
+    for (uint i = 0; i < actEnd.size(); i++)
     {
-        if (ch[i] != s.ch[i])
-            return false;
-    }
-    
-    for (uint i = 0; i < actClk.size(); i++)
-    {
-        if (actClk[i] != s.actClk[i])
-            return false;
+        s.pushWord(actEnd[i].size());
+
+        for (std::deque<unsigned long long>::const_iterator 
+                iter = actEnd[i].begin(); iter != actEnd[i].end(); iter++)
+        {
+            s.pushWord(*iter - time);
+        }
     }
-    
-    return true;
 }
 
 /******************************************************************************
@@ -131,26 +135,22 @@ bool SDFstateSpaceThroughputAnalysis::TransitionSystem::State::operator==(
  */
 void SDFstateSpaceThroughputAnalysis::TransitionSystem::initOutputActor()
 {
-    RepetitionVector repVec;
     int min = INT_MAX;
     SDFactor *a = NULL;
 
-    // Compute repetition vector
-    repVec = computeRepetitionVector(g);
-    
     // Select actor with lowest entry in repetition vector as output actor
     for (SDFactorsIter iter = g->actorsBegin(); iter != g->actorsEnd(); iter++)
     {
-        if (repVec[(*iter)->getId()] < min)
+        if (flatGraph.repetitions((*iter)->getId()) < min)
         {
             a = *iter;
-            min = repVec[a->getId()];
+            min = flatGraph.repetitions(a->getId());
         }
     }
     
     // Set output actor and its repetition vector count
     outputActor = a->getId();
-    outputActorRepCnt = repVec[outputActor];
+    outputActorRepCnt = flatGraph.repetitions(outputActor);
 }
 
 /**
@@ -164,27 +164,9 @@ void SDFstateSpaceThroughputAnalysis::TransitionSystem::initOutputActor()
 bool SDFstateSpaceThroughputAnalysis::TransitionSystem::storeState(State &s,
         StatesIter &pos)
 {
-    // Find state in the list of stored states
-    for (StatesIter iter = storedStates.begin();
-            iter != storedStates.end(); iter++)
-    {
-        State &x = *iter;
-        
-        // State s at position iter in the list?
-        if (x == s)
-        {
-            pos = iter;
-            return false;
-        }
-    }
+    s.pack(encodedState);
     
-    // State not found, store it at the end of the list
-    storedStates.push_back(s);
-    
-    // Added state to the end of the list
-    pos = storedStates.end();
-    
-    return true;
+    return storedStates.store(encodedState, pos);
 }
 
 /**  
@@ -199,16 +181,14 @@ TDtime SDFstateSpaceThroughputAnalysis::TransitionSystem::computeThroughput(
 	TDtime time = 0;  
 
 	// Check all state from stack till cycle complete  
-	for (StatesIter iter = cycleIter; iter != storedStates.end(); iter++)
+	for (StatesIter iter = cycleIter; iter != storedStates.size(); iter++)
     {
-        State &s = *iter;
-
         // Number of states in cycle is equal to number of iterations 
         // in the period
         nr_fire++;
 
 	    // Time between previous state  
-	    time += s.glbClk;
+	    time += storedStates.getLong(iter, 0);
 	}
 
 	return (TDtime)(nr_fire)/(time);  
@@ -223,30 +203,19 @@ TDtime SDFstateSpaceThroughputAnalysis::TransitionSystem::computeThroughput(
 #define CONSUME(c,n)        CH(c) = CH(c) - n;
 #define PRODUCE(c,n)        CH(c) = CH(c) + n;
 
-#define CH_TOKENS_PREV(c,n) (previousState.ch[c] >= n)  
-
 /**
  * actorReadyToFire ()
  * The function returns true when the actor is ready to fire in state
  * s. Else it returns false.
  */
 bool SDFstateSpaceThroughputAnalysis::TransitionSystem::actorReadyToFire(
-        SDFactor *a)
+        const CId a)
 {
     // Check all input ports for tokens
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    for (uint p = flatGraph.inBegin(a); p < flatGraph.inEnd(a); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-        
-        // Actor is destination of the channel?
-        if (p->getType() == SDFport::In)
-        {
-            if (!CH_TOKENS(c->getId(), p->getRate()))
-            {
-                return false;
-            }    
-        }
+        if (!CH_TOKENS(flatGraph.inChannel(p), flatGraph.inRate(p)))
+            return false;
     }
 
     return true;
@@ -255,76 +224,85 @@ bool SDFstateSpaceThroughputAnalysis::TransitionSystem::actorReadyToFire(
 /**
  * startActorFiring ()
  * Start the actor firing. Remove tokens from all input channels and add the
- * actor firing to the list of active actor firings and advance sequence
- * position.
+ * completion time of the actor firing to the list of active actor firings
+ * and to the heap of completion times.
  */
 void SDFstateSpaceThroughputAnalysis::TransitionSystem::startActorFiring(
-        TimedSDFactor *a)
+        const CId a)
 {
-    // Consume tokens from inputs and space for output tokens
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    const unsigned long long end = currentState.time 
+                                        + flatGraph.executionTime(a);
+
+    // Consume tokens from inputs
+    for (uint p = flatGraph.inBegin(a); p < flatGraph.inEnd(a); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-        
-        // Actor is destination of the channel?
-        if (p->getType() == SDFport::In)
-        {
-            CONSUME(c->getId(), p->getRate());
-        }
+        CONSUME(flatGraph.inChannel(p), flatGraph.inRate(p));
     }
 
     // Add actor firing to the list of active firings of this actor
-    currentState.actClk[a->getId()].push_back(a->getExecutionTime());
+    currentState.actEnd[a].push_back(end);
+    completions.push_back(Completion(end, a));
+    std::push_heap(completions.begin(), completions.end(), 
+                std::greater<Completion>());
 
 #ifdef _PRINT_STATESPACE
-    cout << "start: " << a->getName() << endl;
+    cout << "start: " << g->getActor(a)->getName() << endl;
 #endif
 }
 
 /**
  * actorReadyToEnd ()
- * The function returns true when the actor is ready to end its firing. Else
- * the function returns false.
+ * The function returns true when a firing completes at the current time and
+ * sets a to the actor of this firing. Firings which complete at the same time
+ * are returned in the order of the ids of their actors. Else the function
+ * returns false.
  */
 bool SDFstateSpaceThroughputAnalysis::TransitionSystem::actorReadyToEnd(
-        SDFactor *a)
+        CId &a)
 {
-    if (currentState.actClk[a->getId()].empty())
+    if (completions.empty())
         return false;
     
-    // First actor firing in sorted list has execution time left?
-    if (currentState.actClk[a->getId()].front() != 0)
+    // First firing in the heap has execution time left?
+    if (completions.front().first != currentState.time)
         return false;
 
+    a = completions.front().second;
+
     return true;
 }
 
 /**
  * endActorFiring ()
  * Produce tokens on all output channels and remove the actor firing from the
- * list of active firings.
+ * list of active firings. The destination actors of the output channels may
+ * become ready to fire.
  */
 void SDFstateSpaceThroughputAnalysis::TransitionSystem::endActorFiring(
-        SDFactor *a)
+        const CId a)
 {
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    for (uint p = flatGraph.outBegin(a); p < flatGraph.outEnd(a); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-        
-        // Actor is source of the channel?
-        if (p->getType() == SDFport::Out)
+        const CId c = flatGraph.outChannel(p);
+        const CId b = flatGraph.dstActor(c);
+
+        PRODUCE(c, flatGraph.outRate(p));
+
+        if (!isReadyCandidate[b])
         {
-            PRODUCE(c->getId(), p->getRate());
+            isReadyCandidate[b] = true;
+            readyCandidates.push_back(b);
         }
     }
 
     // Remove the firing from the list of active actor firings
-    currentState.actClk[a->getId()].pop_front();
+    currentState.actEnd[a].pop_front();
+    std::pop_heap(completions.begin(), completions.end(), 
+                std::greater<Completion>());
+    completions.pop_back();
 
 #ifdef _PRINT_STATESPACE
-    cout << "end:   " << a->getName() << endl;
+    cout << "end:   " << g->getActor(a)->getName() << endl;
 #endif
 }
 
@@ -336,46 +314,20 @@ void SDFstateSpaceThroughputAnalysis::TransitionSystem::endActorFiring(
  */
 SDFtime SDFstateSpaceThroughputAnalysis::TransitionSystem::clockStep()
 {
-    SDFtime step = UINT_MAX;
-    
-    // Find maximal time progress
-    for (uint a = 0; a < g->nrActors(); a++)
-    {
-        if (!currentState.actClk[a].empty())
-        {
-            SDFtime actClk = currentState.actClk[a].front();
-
-            if (step > actClk)
-                step = actClk;
-        }
-    }
-
-    // Still actors ready to end their firing?
-    if (step == 0)
-        return 0;
-
-	// Check for progress (i.e. no deadlock) 
-	if (step == UINT_MAX)
+    // Check for progress (i.e. no deadlock) 
+    if (completions.empty())
         return UINT_MAX;
 
-    // Lower remaining execution time actors
-    for (uint a = 0; a < g->nrActors(); a++)
-    {
-        for (list<SDFtime>::iterator iter = currentState.actClk[a].begin();
-                    iter != currentState.actClk[a].end(); iter++)
-        {
-            SDFtime &actFiringTime = *iter;
-            
-            // Lower remaining execution time of the actor firing
-            actFiringTime -= step;
-        }
-    }
+    // Time till the first firing completes
+    SDFtime step = completions.front().first - currentState.time;
 
-    // Advance the global clock  
+    // Advance the current time and the global clock
+    currentState.time += step;
     currentState.glbClk += step;
 
 #ifdef _PRINT_STATESPACE
-    cout << "clk:   " << step << endl;
+    if (step != 0)
+        cout << "clk:   " << step << endl;
 #endif
 
     return step;
@@ -384,13 +336,16 @@ SDFtime SDFstateSpaceThroughputAnalysis::TransitionSystem::clockStep()
 /**  
  * execSDFgraph()  
  * Execute the SDF graph till a deadlock is found or a recurrent state.  
- * The throughput is returned.  
+ * The throughput is returned. Only actors which received tokens since they
+ * were last checked are checked for being ready to fire, and time advances
+ * directly to the first completion time on the heap of active firings.
  */  
 TDtime SDFstateSpaceThroughputAnalysis::TransitionSystem::execSDFgraph()  
 {
     StatesIter recurrentState;
     SDFtime clkStep;
     int repCnt = 0;  
+    CId a;
 
     // Clear the list of stored states
     clearStoredStates();
@@ -398,18 +353,20 @@ TDtime SDFstateSpaceThroughputAnalysis::TransitionSystem::execSDFgraph()
     // Create initial state
     currentState.init(g->nrActors(), g->nrChannels());
     currentState.clear();  
-    previousState.init(g->nrActors(), g->nrChannels());
-    previousState.clear();  
+    completions.clear();
 
     // Initial tokens and space
-    for (SDFchannelsIter iter = g->channelsBegin();
-            iter != g->channelsEnd(); iter++)
+    for (uint c = 0; c < flatGraph.nrChannels(); c++)
     {
-        SDFchannel *c = *iter;
-        
-        CH(c->getId()) = c->getInitialTokens();
+        CH(c) = flatGraph.initialTokens(c);
     }
 
+    // All actors may be ready to fire in the initial state
+    readyCandidates.clear();
+    isReadyCandidate.assign(g->nrActors(), true);
+    for (uint i = 0; i < g->nrActors(); i++)
+        readyCandidates.push_back(i);
+
 #ifdef _PRINT_STATESPACE
     cout << "### start statespace exploration" << endl;
 #endif
@@ -417,51 +374,39 @@ TDtime SDFstateSpaceThroughputAnalysis::TransitionSystem::execSDFgraph()
     // Fire the actors  
     while (true)  
     {
-        // Store partial state to check for progress
-        for (uint i = 0; i < g->nrChannels(); i++)
-        {
-            previousState.ch[i] = currentState.ch[i];
-        }
-
         // Finish actor firings  
-        for (SDFactorsIter iter = g->actorsBegin();
-                iter != g->actorsEnd(); iter++)
+        while (actorReadyToEnd(a))  
         {
-            SDFactor *a = *iter;
-            
-            while (actorReadyToEnd(a))  
+            if (outputActor == a)
             {
-                if (outputActor == a->getId())
-                {
-                    repCnt++;
-                    if (repCnt == outputActorRepCnt)  
-                    { 
+                repCnt++;
+                if (repCnt == outputActorRepCnt)  
+                { 
 #ifdef _PRINT_STATESPACE
-                        printState(currentState, cout);
+                    currentState.print(cout);
 #endif
-                        // Add state to hash of visited states  
-                        if (!storeState(currentState, recurrentState))
-                        {
+                    // Add state to hash of visited states  
+                    if (!storeState(currentState, recurrentState))
+                    {
 #ifdef _PRINT_STATESPACE
-                            cout << "### end statespace exploration" << endl;
+                        cout << "### end statespace exploration" << endl;
 #endif
-                            return computeThroughput(recurrentState);
-                        }
-	                    currentState.glbClk = 0;
-                        repCnt = 0;
-                    }  
-                }
-
-                // End the actor firing
-                endActorFiring(a);
-            }  
+                        return computeThroughput(recurrentState);
+                    }
+                    currentState.glbClk = 0;
+                    repCnt = 0;
+                }  
+            }
+
+            // End the actor firing
+            endActorFiring(a);
         }
 
         // Start actor firings  
-        for (SDFactorsIter iter = g->actorsBegin();
-                iter != g->actorsEnd(); iter++)
+        for (uint i = 0; i < readyCandidates.size(); i++)
         {
-            TimedSDFactor *a = (TimedSDFactor*)(*iter);
+            a = readyCandidates[i];
+            isReadyCandidate[a] = false;
         
             // Ready to fire actor a?
             while (actorReadyToFire(a))
@@ -470,6 +415,7 @@ TDtime SDFstateSpaceThroughputAnalysis::TransitionSystem::execSDFgraph()
                 startActorFiring(a);
             }
         }
+        readyCandidates.clear();
 
         // Clock step
         clkStep = clockStep();
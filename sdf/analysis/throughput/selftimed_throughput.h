@@ -37,6 +37,10 @@
 #define SDF_ANALYSIS_STATESPACE_SELFTIMED_THROUGHPUT_H_INCLUDED
 
 #include "../../base/timed/graph.h"
+#include "../statespace/state.h"
+#include "../statespace/flat_graph.h"
+#include <deque>
+#include <functional>
 
 /**
  * Throughput analysis
@@ -81,32 +85,34 @@ private:
             // Initialize the state    
             void init(const uint nrActors, const uint nrChannels)
             {
-                actClk.resize(nrActors);
+                actEnd.resize(nrActors);
                 ch.resize(nrChannels);
             };
 
-            // Compare states
-            bool operator==(const State &s);
-
             // Clear state
             void clear();
 
+            // Encode the state into a compact state
+            void pack(SDFcompactState &s) const;
+
             // Output state
             void print(ostream &out);
 
-            // State information
-            vector< list<SDFtime> > actClk;
+            // State information (the active firings of an actor are kept
+            // as absolute completion times in the order in which they end)
+            vector< std::deque<unsigned long long> > actEnd;
             vector< TBufSize > ch;
+            unsigned long long time;
             unsigned long glbClk;
         };
 
-        // Sequence of states in transition system        
-        typedef list<State>      States;
-        typedef States::iterator StatesIter;
+        // Position of a state in the transition system
+        typedef SDFstatePos StatesIter;
 
         // Constructor
         TransitionSystem(TimedSDFgraph *gr) {
             g = gr;
+            flatGraph.compile(g);
             initOutputActor();   
         };
         
@@ -127,10 +133,10 @@ private:
         TDtime computeThroughput(const StatesIter cycleIter);
 
         // State transitions
-        bool actorReadyToFire(SDFactor *a);
-        void startActorFiring(TimedSDFactor *a);
-        bool actorReadyToEnd(SDFactor *a);
-        void endActorFiring(SDFactor *a);
+        bool actorReadyToFire(const CId a);
+        void startActorFiring(const CId a);
+        bool actorReadyToEnd(CId &a);
+        void endActorFiring(const CId a);
         SDFtime clockStep();
 
         // Output actor
@@ -141,12 +147,25 @@ private:
         CId outputActor;
         TCnt outputActorRepCnt;
         
-        // Current and previous state
+        // Flat execution model of the graph
+        SDFflatGraph flatGraph;
+
+        // Current state
         State currentState; 
-        State previousState;
 
-        // List of visited states that are stored
-        States storedStates;
+        // Completion times of the active firings (min-heap)
+        typedef std::pair<unsigned long long, CId> Completion;
+        vector<Completion> completions;
+
+        // Actors which may have become ready to fire
+        vector<CId> readyCandidates;
+        vector<bool> isReadyCandidate;
+
+        // Visited states that are stored
+        SDFstateStore storedStates;
+
+        // Encoding of the state which is being stored
+        SDFcompactState encodedState;
     };
 };
 
@@ -143,6 +143,30 @@ void SDFstateSpaceBindingAwareThroughputAnalysis::TransitionSystem::State
     }
 }
 
+/**
+ * pack ()
+ * The function writes the state into the compact state s. The global clock is
+ * stored at word offset zero.
+ */
+void SDFstateSpaceBindingAwareThroughputAnalysis::TransitionSystem::State::pack(
+        SDFcompactState &s) const
+{
+    s.clear();
+    s.pushLong(glbClk);
+
+    for (uint i = 0; i < ch.size(); i++)
+        s.pushWord(ch[i]);
+
+    for (uint i = 0; i < actClk.size(); i++)
+        s.pushClocks(actClk[i]);
+
+    for (uint i = 0; i < schedulePos.size(); i++)
+    {
+        s.pushWord(schedulePos[i]);
+        s.pushWord(tdmaPos[i]);
+    }
+}
+
 /******************************************************************************
  * Transition system
  *****************************************************************************/
@@ -215,27 +239,9 @@ void SDFstateSpaceBindingAwareThroughputAnalysis::TransitionSystem
 bool SDFstateSpaceBindingAwareThroughputAnalysis::TransitionSystem::storeState(
         State &s, StatesIter &pos)
 {
-    // Find state in the list of stored states
-    for (StatesIter iter = storedStates.begin();
-            iter != storedStates.end(); iter++)
-    {
-        State &x = *iter;
-        
-        // State s at position iter in the list?
-        if (x == s)
-        {
-            pos = iter;
-            return false;
-        }
-    }
-    
-    // State not found, store it at the end of the list
-    storedStates.push_back(s);
-    
-    // Added state to the end of the list
-    pos = storedStates.end();
+    s.pack(encodedState);
     
-    return true;
+    return storedStates.store(encodedState, pos);
 }
 
 /**  
@@ -250,16 +256,14 @@ TDtime SDFstateSpaceBindingAwareThroughputAnalysis::TransitionSystem
 	TDtime time = 0;  
 
 	// Check all state from stack till cycle complete  
-	for (StatesIter iter = cycleIter; iter != storedStates.end(); iter++)
+	for (StatesIter iter = cycleIter; iter != storedStates.size(); iter++)
     {
-        State &s = *iter;
-
         // Number of states in cycle is equal to number of iterations 
         // in the period
         nr_fire++;
 
 	    // Time between previous state  
-	    time += s.glbClk;
+	    time += storedStates.getLong(iter, 0);
 	}
 
 	return (TDtime)(nr_fire)/(time);  
@@ -285,16 +289,14 @@ void SDFstateSpaceBindingAwareThroughputAnalysis::TransitionSystem
     
 	// Check all state from stack till cycle complete  
 	for (StatesIter iter = recurrentState;
-            iter != storedStates.end(); iter++)
+            iter != storedStates.size(); iter++)
     {
-        State &s = *iter;
-
         // Number of states in cycle is equal to number of iterations 
         // in the period
         nrItersInPeriod++;
 
 	    // Time between previous state  
-	    lengthOfPeriod += s.glbClk;
+	    lengthOfPeriod += storedStates.getLong(iter, 0);
 	}
     
     // The activity of a processor is given by the sum of execution time of the
@@ -356,19 +358,11 @@ bool SDFstateSpaceBindingAwareThroughputAnalysis::TransitionSystem
     }
     
     // Check all input ports for tokens
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    for (uint p = flatGraph.inBegin(a->getId()); 
+            p < flatGraph.inEnd(a->getId()); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-        
-        // Actor is destination of the channel?
-        if (p->getType() == SDFport::In)
-        {
-            if (!CH_TOKENS(c->getId(), p->getRate()))
-            {
-                return false;
-            }    
-        }
+        if (!CH_TOKENS(flatGraph.inChannel(p), flatGraph.inRate(p)))
+            return false;
     }
 
     return true;
@@ -386,21 +380,15 @@ void SDFstateSpaceBindingAwareThroughputAnalysis::TransitionSystem
     SDFtime execTime, completionTime, timeTileStartOfSlice, waitingTime;
     int remainingExecTime, nrOfFullRotationsInNonReservedPart;
     
-    // Consume tokens from inputs and space for output tokens
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    // Consume tokens from inputs
+    for (uint p = flatGraph.inBegin(a->getId()); 
+            p < flatGraph.inEnd(a->getId()); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-        
-        // Actor is destination of the channel?
-        if (p->getType() == SDFport::In)
-        {
-            CONSUME(c->getId(), p->getRate());
-        }
+        CONSUME(flatGraph.inChannel(p), flatGraph.inRate(p));
     }
 
     // Execution time of the actor
-    execTime = a->getExecutionTime();
+    execTime = flatGraph.executionTime(a->getId());
     
     // Compute time needed to complete actor firing
     if (bindingAwareSDFG->getBindingOfActorToTile(a) == ACTOR_NOT_BOUND)
@@ -488,16 +476,11 @@ bool SDFstateSpaceBindingAwareThroughputAnalysis::TransitionSystem
 void SDFstateSpaceBindingAwareThroughputAnalysis::TransitionSystem
     ::endActorFiring(SDFactor *a)
 {
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    // Produce tokens on outputs
+    for (uint p = flatGraph.outBegin(a->getId()); 
+            p < flatGraph.outEnd(a->getId()); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-        
-        // Actor is source of the channel?
-        if (p->getType() == SDFport::Out)
-        {
-            PRODUCE(c->getId(), p->getRate());
-        }
+        PRODUCE(flatGraph.outChannel(p), flatGraph.outRate(p));
     }
 
     // Remove the firing from the list of active actor firings
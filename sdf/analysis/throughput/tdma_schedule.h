@@ -40,6 +40,8 @@
 #define SDF_ANALYSIS_STATESPACE_TDMA_SCHEDULE_H_INCLUDED
 
 #include "../../resource_allocation/binding_aware_sdfg/binding_aware_sdfg.h"
+#include "../statespace/state.h"
+#include "../statespace/flat_graph.h"
 
 /**
  * Binding-aware throughput analysis
@@ -102,6 +104,9 @@ private:
             // Clear state
             void clear();
 
+            // Encode the state into a compact state
+            void pack(SDFcompactState &s) const;
+
             // Output state
             void print(ostream &out);
 
@@ -113,14 +118,14 @@ private:
             vector< SDFtime > tdmaPos;
         };
 
-        // Sequence of states in transition system        
-        typedef list<State>      States;
-        typedef States::iterator StatesIter;
+        // Position of a state in the transition system
+        typedef SDFstatePos StatesIter;
 
         // Constructor
         TransitionSystem(BindingAwareSDFG *bg) {
             bindingAwareSDFG = bg;
             checkBindingAwareSDFG();
+            flatGraph.compile(bindingAwareSDFG);
             initOutputActor();
         };
         
@@ -160,6 +165,9 @@ private:
         // Binding-aware SDFG
         BindingAwareSDFG *bindingAwareSDFG;
 
+        // Flat execution model of the binding-aware SDFG
+        SDFflatGraph flatGraph;
+
         // SDF graph and output actor
         SDFactor *outputActor;
         TCnt outputActorRepCnt;
@@ -168,8 +176,11 @@ private:
         State currentState; 
         State previousState;
 
-        // List of visited states that are stored
-        States storedStates;
+        // Visited states that are stored
+        SDFstateStore storedStates;
+
+        // Encoding of the state which is being stored
+        SDFcompactState encodedState;
     };
 };
 
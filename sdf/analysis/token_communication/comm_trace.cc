@@ -139,6 +139,30 @@ void SDFstateSpaceTraceInterconnectCommunication::TransitionSystem::State
     }
 }
 
+/**
+ * pack ()
+ * The function writes the state into the compact state s. The global clock is
+ * stored at word offset zero.
+ */
+void SDFstateSpaceTraceInterconnectCommunication::TransitionSystem::State::pack(
+        SDFcompactState &s) const
+{
+    s.clear();
+    s.pushLong(glbClk);
+
+    for (uint i = 0; i < ch.size(); i++)
+        s.pushWord(ch[i]);
+
+    for (uint i = 0; i < actClk.size(); i++)
+        s.pushClocks(actClk[i]);
+
+    for (uint i = 0; i < schedulePos.size(); i++)
+    {
+        s.pushWord(schedulePos[i]);
+        s.pushWord(tdmaPos[i]);
+    }
+}
+
 /******************************************************************************
  * Transition system
  *****************************************************************************/
@@ -211,27 +235,9 @@ void SDFstateSpaceTraceInterconnectCommunication::TransitionSystem
 bool SDFstateSpaceTraceInterconnectCommunication::TransitionSystem::storeState(
         State &s, StatesIter &pos)
 {
-    // Find state in the list of stored states
-    for (StatesIter iter = storedStates.begin();
-            iter != storedStates.end(); iter++)
-    {
-        State &x = *iter;
-        
-        // State s at position iter in the list?
-        if (x == s)
-        {
-            pos = iter;
-            return false;
-        }
-    }
-    
-    // State not found, store it at the end of the list
-    storedStates.push_back(s);
-    
-    // Added state to the end of the list
-    pos = storedStates.end();
+    s.pack(encodedState);
     
-    return true;
+    return storedStates.store(encodedState, pos);
 }
 
 /******************************************************************************
@@ -287,9 +293,7 @@ void SDFstateSpaceTraceInterconnectCommunication::TransitionSystem
     tileClock = new TTime [bindingAwareSDFG->nrTilesInPlatformGraph()];
 
     // Initialize periodic state
-    periodicState.init(bindingAwareSDFG->nrActors(), 
-                        bindingAwareSDFG->nrChannels(), 
-                        bindingAwareSDFG->nrTilesInPlatformGraph());
+    periodicState = SDFSTATEPOS_NONE;
 
     // No tokens produced or consumed yet
     for (uint i = 0; i < bindingAwareSDFG->nrChannels(); i++)
@@ -397,16 +401,13 @@ void SDFstateSpaceTraceInterconnectCommunication::TransitionSystem
         t->nextInChannel = NULL;
 
         // Associate last stored state with the token
-        if (storedStates.empty())
+        if (storedStates.size() == 0)
         {
-            t->state = State(bindingAwareSDFG->nrActors(),
-                                bindingAwareSDFG->nrChannels(), 
-                                bindingAwareSDFG->nrTilesInPlatformGraph());
-            t->state.clear();
+            t->state = SDFSTATEPOS_NONE;
         }
         else
         {
-            t->state = storedStates.back();
+            t->state = storedStates.size() - 1;
         }
         t->inPeriodicPhase = false;
 
@@ -494,7 +495,7 @@ void SDFstateSpaceTraceInterconnectCommunication::TransitionSystem
     while (t != NULL)
     {
         // State in which token was stored equal to periodic state?
-        if (t->state == periodicState)
+        if (foundPeriodicState && t->state == periodicState)
         {
             periodic = true;
         }
@@ -836,12 +837,10 @@ TTime SDFstateSpaceTraceInterconnectCommunication::TransitionSystem
 
 	// Check all state from stack till cycle complete  
 	for (StatesIter iter = cycleIter;
-            iter != storedStates.end(); iter++)
+            iter != storedStates.size(); iter++)
     {
-        State &s = *iter;
-
 	    // Time between previous state  
-	    time += s.glbClk;
+	    time += storedStates.getLong(iter, 0);
 	}
 
 	return time;
@@ -1168,7 +1167,7 @@ TTime SDFstateSpaceTraceInterconnectCommunication::TransitionSystem
                         if (!storeState(currentState, recurrentState))
                         {
                             foundPeriodicState = true;
-                            periodicState = currentState;
+                            periodicState = recurrentState;
                             lengthPeriodicState 
                                 = computeLengthPeriodicPhase(recurrentState);
                         }
@@ -38,6 +38,7 @@
 #define SDF_ANALYSIS_STATESPACE_COMM_TRACE_H_INCLUDED
 
 #include "../../resource_allocation/binding_aware_sdfg/binding_aware_sdfg.h"
+#include "../statespace/state.h"
 
 /**
  * Trace interconnect communication
@@ -99,6 +100,9 @@ private:
             // Clear state
             void clear();
 
+            // Encode the state into a compact state
+            void pack(SDFcompactState &s) const;
+
             // Output state
             void print(ostream &out);
 
@@ -110,9 +114,8 @@ private:
             vector< SDFtime > tdmaPos;
         };
 
-        // Sequence of states in transition system        
-        typedef list<State>      States;
-        typedef States::iterator StatesIter;
+        // Position of a state in the transition system
+        typedef SDFstatePos StatesIter;
 
         // Constructor
         TransitionSystem(BindingAwareSDFG *bg, PlatformGraph *pg) {
@@ -185,8 +188,11 @@ private:
         State currentState; 
         State previousState;
 
-        // List of visited states that are stored
-        States storedStates;
+        // Visited states that are stored
+        SDFstateStore storedStates;
+
+        // Encoding of the state which is being stored
+        SDFcompactState encodedState;
         
         /***********************************************************************
          * Tracing
@@ -198,7 +204,7 @@ private:
         bool foundPeriodicState;
 
         // Periodic state
-        State periodicState;
+        StatesIter periodicState;
 
         // Source/destination tile of a channel
         uint *srcTileCh;
@@ -227,7 +233,7 @@ private:
             struct _Token *nextInChannel;
 
             // Last stored state before token production
-            State state;
+            StatesIter state;
 
             // Token belongs to periodic phase
             bool inPeriodicPhase;
@@ -58,3 +58,31 @@ SDFcomponent::SDFcomponent(SDFcomponent *parent, const CId id,
         name(name)
 {
 }
+
+/**
+ * setId ()
+ * The function sets the id of the component. The parent is informed, so it
+ * can update its index on its components.
+ */
+void SDFcomponent::setId(CId i)
+{
+    id = i;
+
+    if (parent != NULL)
+        parent->changedComponent(this, name);
+}
+
+/**
+ * setName ()
+ * The function sets the name of the component. The parent is informed, so it
+ * can update its index on its components.
+ */
+void SDFcomponent::setName(const CString &n)
+{
+    CString oldName = name;
+    
+    name = n;
+
+    if (parent != NULL)
+        parent->changedComponent(this, oldName);
+}
@@ -38,6 +38,7 @@
 
 #include "base/base.h"
 #include "../../basic_types.h"
+#include <tr1/unordered_map>
 
 // Forward class definition
 class SDFcomponent;
@@ -59,11 +60,15 @@ public:
 
     // Information
     CId getId() const { return id; };
-    void setId(CId i) { id = i; };
+    void setId(CId i);
     SDFcomponent *getParent() const { return parent; };
     CString getName() const { return name; };
-    void setName(const CString &n) { name = n; };
+    void setName(const CString &n);
     
+protected:
+    // Id or name of a child component changed (oldName is its previous name)
+    virtual void changedComponent(SDFcomponent *c, const CString &oldName) {};
+
 private:
     // Information
     SDFcomponent *parent;
@@ -71,4 +76,142 @@ private:
     CString name;
 };
 
+/**
+ * SDFcomponentIndex
+ * Index on a list of components. A component is located through a vector on
+ * its id and through a hash map on its name. Components enter the index when
+ * they are added to the list, and the owner of the list updates the index
+ * when the id or name of one of its components changes. When several
+ * components have the same name, the one that was added first is found, just
+ * like a scan of the list would. A lookup never modifies the index, so it can
+ * be done by several threads at the same time. A lookup which misses the
+ * index falls back to a scan of the list. The index must be rebuilt when a
+ * component is removed from the list.
+ */
+template <class T>
+class SDFcomponentIndex
+{
+public:
+    // Constructor
+    SDFcomponentIndex() { nrAdded = 0; };
+
+    // Add a component to the index
+    void add(T *c)
+    {
+        order[c] = nrAdded++;
+        setId(c);
+        setName(c);
+    };
+    
+    // Update the index after the id or name of component c changed. The
+    // function returns false when c is not in the index.
+    bool update(SDFcomponent *c, const CString &oldName)
+    {
+        typename ComponentNames::iterator n;
+        T *t;
+
+        if (order.find(c) == order.end())
+            return false;
+        t = static_cast<T*>(c);
+
+        // Remove the old name from the index
+        n = names.find(oldName);
+        if (n != names.end() && n->second == t)
+            names.erase(n);
+        
+        setId(t);
+        setName(t);
+
+        return true;
+    };
+
+    // Rebuild the index from the list of components
+    void rebuild(list<T*> &l)
+    {
+        ids.clear();
+        names.clear();
+        order.clear();
+        nrAdded = 0;
+        
+        for (typename list<T*>::iterator iter = l.begin();
+                iter != l.end(); iter++)
+        {
+            add(*iter);
+        }
+    };
+    
+    // Component with the given id (NULL when not in list)
+    T *find(const CId id, const list<T*> &l) const
+    {
+        if (id < ids.size() && ids[id] != NULL && ids[id]->getId() == id)
+            return ids[id];
+        
+        for (typename list<T*>::const_iterator iter = l.begin();
+                iter != l.end(); iter++)
+        {
+            if ((*iter)->getId() == id)
+                return *iter;
+        }
+        
+        return NULL;
+    };
+    
+    // Component with the given name (NULL when not in list)
+    T *find(const CString &name, const list<T*> &l) const
+    {
+        typename ComponentNames::const_iterator n = names.find(name);
+        
+        if (n != names.end() && n->second->getName() == name)
+            return n->second;
+        
+        for (typename list<T*>::const_iterator iter = l.begin();
+                iter != l.end(); iter++)
+        {
+            if ((*iter)->getName() == name)
+                return *iter;
+        }
+        
+        return NULL;
+    };
+
+private:
+    // Place component in the id index
+    void setId(T *c)
+    {
+        if (c->getId() >= ids.size())
+            ids.resize(c->getId() + 1, NULL);
+        ids[c->getId()] = c;
+    };
+
+    // Place component in the name index, unless a component with the same
+    // name was added before it
+    void setName(T *c)
+    {
+        typename ComponentNames::iterator n;
+        
+        n = names.insert(make_pair(c->getName(), c)).first;
+        if (n->second != c && (n->second->getName() != c->getName()
+                || order.find(n->second)->second > order.find(c)->second))
+        {
+            n->second = c;
+        }
+    };
+
+    // Hash map from names to components
+    typedef std::tr1::unordered_map<std::string, T*> ComponentNames;
+
+    // Hash map from components to the order in which they were added
+    typedef std::tr1::unordered_map<const SDFcomponent*, CSize> ComponentOrder;
+
+    // Components indexed on their id
+    vector<T*> ids;
+    
+    // Components indexed on their name
+    ComponentNames names;
+    
+    // Order in which the components were added
+    ComponentOrder order;
+    CSize nrAdded;
+};
+
 #endif
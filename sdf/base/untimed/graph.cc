@@ -196,13 +196,10 @@ void SDFgraph::construct(const CNodePtr sdfNode)
  */
 SDFactor *SDFgraph::getActor(const CId id)
 {
-    for (SDFactorsIter iter = actors.begin(); iter != actors.end(); iter++)
-    {
-        SDFactor *a = *iter;
-        
-        if (a->getId() == id)
-            return a;
-    }
+    SDFactor *a = actorIndex.find(id, actors);
+    
+    if (a != NULL)
+        return a;
     
     throw CException("Graph '" + getName() + "' has no actor with id '"
                         + CString(id) + "'.");
@@ -214,15 +211,7 @@ SDFactor *SDFgraph::getActor(const CId id)
  */
 SDFactor *SDFgraph::getActor(const CString &name)
 {
-    for (SDFactorsIter iter = actors.begin(); iter != actors.end(); iter++)
-    {
-        SDFactor *a = *iter;
-        
-        if (a->getName() == name)
-            return a;
-    }
-    
-    return NULL;
+    return actorIndex.find(name, actors);
 }
 
 /**
@@ -232,6 +221,18 @@ SDFactor *SDFgraph::getActor(const CString &name)
 void SDFgraph::addActor(SDFactor *a)
 {
     actors.push_back(a);
+    actorIndex.add(a);
+}
+
+/**
+ * changedComponent ()
+ * The function updates the index on the actors and channels after the id or
+ * name of component c changed.
+ */
+void SDFgraph::changedComponent(SDFcomponent *c, const CString &oldName)
+{
+    if (!actorIndex.update(c, oldName))
+        channelIndex.update(c, oldName);
 }
 
 /**
@@ -247,6 +248,7 @@ void SDFgraph::removeActor(const CString &name)
         if (a->getName() == name)
         {
             actors.erase(iter);
+            actorIndex.rebuild(actors);
             return;
         }
     }
@@ -286,14 +288,10 @@ SDFactor *SDFgraph::createActor(SDFcomponent &c)
  */
 SDFchannel *SDFgraph::getChannel(const CId id)
 {
-    for (SDFchannelsIter iter = channels.begin(); 
-            iter != channels.end(); iter++)
-    {
-        SDFchannel *c = *iter;
-        
-        if (c->getId() == id)
-            return c;
-    }
+    SDFchannel *c = channelIndex.find(id, channels);
+    
+    if (c != NULL)
+        return c;
     
     throw CException("Graph '" + getName() 
                         + "' has no channel with id '" + CString(id) + "'.");
@@ -305,16 +303,7 @@ SDFchannel *SDFgraph::getChannel(const CId id)
  */
 SDFchannel *SDFgraph::getChannel(const CString &name)
 {
-    for (SDFchannelsIter iter = channels.begin(); 
-            iter != channels.end(); iter++)
-    {
-        SDFchannel *c = *iter;
-        
-        if (c->getName() == name)
-            return c;
-    }
-
-    return NULL;
+    return channelIndex.find(name, channels);
 }
 
 /**
@@ -324,6 +313,7 @@ SDFchannel *SDFgraph::getChannel(const CString &name)
 void SDFgraph::addChannel(SDFchannel *c)
 {
     channels.push_back(c);
+    channelIndex.add(c);
 }
 
 /**
@@ -341,6 +331,7 @@ void SDFgraph::removeChannel(const CString &name)
         {
             delete c;
             channels.erase(iter);
+            channelIndex.rebuild(channels);
             return;
         }
     }
@@ -96,6 +96,10 @@ public:
     friend ostream &operator<<(ostream &out, SDFgraph &g)
         { return g.print(out); };
 
+protected:
+    // Id or name of an actor or channel changed
+    virtual void changedComponent(SDFcomponent *c, const CString &oldName);
+
 private:
     // Graph type
     CString type;
@@ -103,6 +107,10 @@ private:
     // Actors and channels
     SDFactors   actors;
     SDFchannels channels;
+    
+    // Index on the actors and channels
+    SDFcomponentIndex<SDFactor> actorIndex;
+    SDFcomponentIndex<SDFchannel> channelIndex;
         
 };
 
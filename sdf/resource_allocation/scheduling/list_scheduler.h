@@ -38,6 +38,8 @@
 #define SDF_RESOURCE_ALLOCATION_SCHEDULING_LIST_SCHEDULER_H_INCLUDED
 
 #include "../../analysis/analysis.h"
+#include "../../analysis/statespace/state.h"
+#include "../../analysis/statespace/flat_graph.h"
 
 /**
  * List scheduler
@@ -98,6 +100,9 @@ private:
             // Clear state
             void clear();
 
+            // Encode the state into a compact state
+            void pack(SDFcompactState &s) const;
+
             // Output state
             void print(ostream &out);
 
@@ -109,13 +114,13 @@ private:
             vector< SDFtime > tdmaPos;
         };
 
-        // Sequence of states in transition system        
-        typedef list<State>      States;
-        typedef States::iterator StatesIter;
+        // Position of a state in the transition system
+        typedef SDFstatePos StatesIter;
 
         // Constructor
         TransitionSystem(BindingAwareSDFG *bg) {
             bindingAwareSDFG = bg;
+            flatGraph.compile(bg);
             initOutputActor();
             initStaticOrderSchedules();
         };
@@ -156,12 +161,18 @@ private:
         SDFactor *outputActor;
         TCnt outputActorRepCnt;
         
+        // Flat execution model of the graph
+        SDFflatGraph flatGraph;
+
         // Current and previous state
         State currentState; 
         State previousState;
 
-        // List of visited states that are stored
-        States storedStates;
+        // Visited states that are stored
+        SDFstateStore storedStates;
+
+        // Encoding of the state which is being stored
+        SDFcompactState encodedState;
 
         // State information for schedulers        
         vector< SDFactors > actorReadyList;
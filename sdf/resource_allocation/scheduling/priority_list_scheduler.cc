@@ -129,6 +129,29 @@ void SDFstateSpacePriorityListScheduler::TransitionSystem::State::print(
     }
 }
 
+/**
+ * pack ()
+ * The function writes the state into the compact state s. The global clock is
+ * stored at word offset zero.
+ */
+void SDFstateSpacePriorityListScheduler::TransitionSystem::State::pack(
+        SDFcompactState &s) const
+{
+    s.clear();
+    s.pushLong(glbClk);
+
+    for (uint i = 0; i < ch.size(); i++)
+        s.pushWord(ch[i]);
+
+    for (uint i = 0; i < actClk.size(); i++)
+        s.pushClocks(actClk[i]);
+
+    // The schedule positions do not identify the state
+    s.endKey();
+    for (uint i = 0; i < schedulePos.size(); i++)
+        s.pushWord(schedulePos[i]);
+}
+
 /******************************************************************************
  * Transition system
  *****************************************************************************/
@@ -317,27 +340,9 @@ void SDFstateSpacePriorityListScheduler::TransitionSystem::initActorPriorities()
 bool SDFstateSpacePriorityListScheduler::TransitionSystem::storeState(State &s,
         StatesIter &pos)
 {
-    // Find state in the list of stored states
-    for (StatesIter iter = storedStates.begin();
-            iter != storedStates.end(); iter++)
-    {
-        State &x = *iter;
-        
-        // State s at position iter in the list?
-        if (x == s)
-        {
-            pos = iter;
-            return false;
-        }
-    }
-    
-    // State not found, store it at the end of the list
-    storedStates.push_back(s);
+    s.pack(encodedState);
     
-    // Added state to the end of the list
-    pos = storedStates.end();
-    
-    return true;
+    return storedStates.store(encodedState, pos);
 }
 
 /**  
@@ -352,16 +357,14 @@ TDtime SDFstateSpacePriorityListScheduler::TransitionSystem::computeThroughput(
 	TDtime time = 0;  
 
 	// Check all state from stack till cycle complete  
-	for (StatesIter iter = cycleIter; iter != storedStates.end(); iter++)
+	for (StatesIter iter = cycleIter; iter != storedStates.size(); iter++)
     {
-        State &s = *iter;
-
         // Number of states in cycle is equal to number of iterations 
         // in the period
         nr_fire++;
 
 	    // Time between previous state  
-	    time += s.glbClk;
+	    time += storedStates.getLong(iter, 0);
 	}
 
 	return (TDtime)(nr_fire)/(time);  
@@ -407,19 +410,13 @@ bool SDFstateSpacePriorityListScheduler::TransitionSystem::actorReadyToFire(
     }
     
     // Check all input ports for tokens
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    for (uint p = flatGraph.inBegin(a->getId());
+            p < flatGraph.inEnd(a->getId()); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-        
-        // Actor is destination of the channel?
-        if (p->getType() == SDFport::In)
+        if (!CH_TOKENS(flatGraph.inChannel(p), flatGraph.inRate(p)))
         {
-            if (!CH_TOKENS(c->getId(), p->getRate()))
-            {
-                return false;
-            }    
-        }
+            return false;
+        }    
     }
 
     return true;
@@ -438,20 +435,14 @@ void SDFstateSpacePriorityListScheduler::TransitionSystem::startActorFiring(
     int remainingExecTime, nrOfFullRotationsInNonReservedPart;
     
     // Consume tokens from inputs and space for output tokens
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    for (uint p = flatGraph.inBegin(a->getId());
+            p < flatGraph.inEnd(a->getId()); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-        
-        // Actor is destination of the channel?
-        if (p->getType() == SDFport::In)
-        {
-            CONSUME(c->getId(), p->getRate());
-        }
+        CONSUME(flatGraph.inChannel(p), flatGraph.inRate(p));
     }
 
     // Execution time of the actor
-    execTime = a->getExecutionTime();
+    execTime = flatGraph.executionTime(a->getId());
     
     // Compute time needed to complete actor firing
     if (bindingAwareSDFG->getBindingOfActorToTile(a) == ACTOR_NOT_BOUND)
@@ -547,16 +538,10 @@ bool SDFstateSpacePriorityListScheduler::TransitionSystem::actorReadyToEnd(
 void SDFstateSpacePriorityListScheduler::TransitionSystem::endActorFiring(
         SDFactor *a)
 {
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    for (uint p = flatGraph.outBegin(a->getId());
+            p < flatGraph.outEnd(a->getId()); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-        
-        // Actor is source of the channel?
-        if (p->getType() == SDFport::Out)
-        {
-            PRODUCE(c->getId(), p->getRate());
-        }
+        PRODUCE(flatGraph.outChannel(p), flatGraph.outRate(p));
     }
 
     // Remove the firing from the list of active actor firings
@@ -707,7 +692,7 @@ TDtime SDFstateSpacePriorityListScheduler::TransitionSystem::execSDFgraph()
                                     // state.
                                     SOS(p).erase(--SOS(p).end());
                                     SOS(p).setStartPeriodicSchedule(
-                                                recurrentState->schedulePos[p]);
+                            storedStates.getPayload(recurrentState)[p]);
                                 }
                                 else if (SOS(p).size() == 1)
                                 {
@@ -745,23 +730,19 @@ TDtime SDFstateSpacePriorityListScheduler::TransitionSystem::execSDFgraph()
                 
                 // Compute number of enabled firings in current 
                 // and previous state
-                for (SDFportsIter iterP = a->portsBegin();
-                        iterP != a->portsEnd(); iterP++)
+                for (uint p = flatGraph.inBegin(a->getId());
+                        p < flatGraph.inEnd(a->getId()); p++)
                 {
-                    SDFport *p = *iterP;
-                    SDFchannel *c = p->getChannel();
+                    const CId c = flatGraph.inChannel(p);
                     uint nrCurrent, nrPrevious;
                     
-                    if (p->getType() == SDFport::In)
-                    {
-                        nrCurrent = currentState.ch[c->getId()] / p->getRate();
-                        nrPrevious = previousState.ch[c->getId()] /p->getRate();
-                        
-                        if (nrCurrent < nrFiringsCurrent)
-                            nrFiringsCurrent = nrCurrent;
-                        if (nrPrevious < nrFiringsPrevious)
-                            nrFiringsPrevious = nrPrevious;
-                    }
+                    nrCurrent = currentState.ch[c] / flatGraph.inRate(p);
+                    nrPrevious = previousState.ch[c] / flatGraph.inRate(p);
+                    
+                    if (nrCurrent < nrFiringsCurrent)
+                        nrFiringsCurrent = nrCurrent;
+                    if (nrPrevious < nrFiringsPrevious)
+                        nrFiringsPrevious = nrPrevious;
                 }
                 
                 if (nrFiringsCurrent <= nrFiringsPrevious)
@@ -121,6 +121,24 @@ bool SDFstateSpaceStaticPeriodicScheduler::TransitionSystem::State::operator==(
     return true;
 }
 
+/**
+ * pack ()
+ * The function writes the state into the compact state s. The global clock is
+ * stored at word offset zero.
+ */
+void SDFstateSpaceStaticPeriodicScheduler::TransitionSystem::State::pack(
+        SDFcompactState &s) const
+{
+    s.clear();
+    s.pushLong(glbClk);
+
+    for (uint i = 0; i < ch.size(); i++)
+        s.pushWord(ch[i]);
+
+    for (uint i = 0; i < actClk.size(); i++)
+        s.pushClocks(actClk[i]);
+}
+
 /******************************************************************************
  * Transition system
  *****************************************************************************/
@@ -165,27 +183,9 @@ void SDFstateSpaceStaticPeriodicScheduler::TransitionSystem::initOutputActor()
 bool SDFstateSpaceStaticPeriodicScheduler::TransitionSystem::storeState(State &s,
         StatesIter &pos)
 {
-    // Find state in the list of stored states
-    for (StatesIter iter = storedStates.begin();
-            iter != storedStates.end(); iter++)
-    {
-        State &x = *iter;
-        
-        // State s at position iter in the list?
-        if (x == s)
-        {
-            pos = iter;
-            return false;
-        }
-    }
+    s.pack(encodedState);
     
-    // State not found, store it at the end of the list
-    storedStates.push_back(s);
-    
-    // Added state to the end of the list
-    pos = storedStates.end();
-    
-    return true;
+    return storedStates.store(encodedState, pos);
 }
 
 /**  
@@ -200,16 +200,14 @@ CFraction SDFstateSpaceStaticPeriodicScheduler::TransitionSystem
 	TDtime time = 0;  
     
 	// Check all state from stack till cycle complete  
-	for (StatesIter iter = cycleIter; iter != storedStates.end(); iter++)
+	for (StatesIter iter = cycleIter; iter != storedStates.size(); iter++)
     {
-        State &s = *iter;
-
         // Number of states in cycle is equal to number of iterations 
         // in the period
         nr_fire++;
 
 	    // Time between previous state  
-	    time += s.glbClk;
+	    time += storedStates.getLong(iter, 0);
 	}
 
 	return CFraction(nr_fire, time);  
@@ -233,19 +231,13 @@ bool SDFstateSpaceStaticPeriodicScheduler::TransitionSystem::actorReadyToFire(
         SDFactor *a)
 {
     // Check all input ports for tokens
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    for (uint p = flatGraph.inBegin(a->getId());
+            p < flatGraph.inEnd(a->getId()); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-        
-        // Actor is destination of the channel?
-        if (p->getType() == SDFport::In)
+        if (!CH_TOKENS(flatGraph.inChannel(p), flatGraph.inRate(p)))
         {
-            if (!CH_TOKENS(c->getId(), p->getRate()))
-            {
-                return false;
-            }    
-        }
+            return false;
+        }    
     }
 
     return true;
@@ -261,20 +253,15 @@ void SDFstateSpaceStaticPeriodicScheduler::TransitionSystem::startActorFiring(
         TimedSDFactor *a)
 {
     // Consume tokens from inputs and space for output tokens
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    for (uint p = flatGraph.inBegin(a->getId());
+            p < flatGraph.inEnd(a->getId()); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-        
-        // Actor is destination of the channel?
-        if (p->getType() == SDFport::In)
-        {
-            CONSUME(c->getId(), p->getRate());
-        }
+        CONSUME(flatGraph.inChannel(p), flatGraph.inRate(p));
     }
 
     // Add actor firing to the list of active firings of this actor
-    currentState.actClk[a->getId()].push_back(a->getExecutionTime());
+    currentState.actClk[a->getId()].push_back(
+            flatGraph.executionTime(a->getId()));
 
 #ifdef _PRINT_STATESPACE
     cout << "start: " << a->getName() << endl;
@@ -307,16 +294,10 @@ bool SDFstateSpaceStaticPeriodicScheduler::TransitionSystem::actorReadyToEnd(
 void SDFstateSpaceStaticPeriodicScheduler::TransitionSystem::endActorFiring(
         SDFactor *a)
 {
-    for (SDFportsIter iter = a->portsBegin(); iter != a->portsEnd(); iter++)
+    for (uint p = flatGraph.outBegin(a->getId());
+            p < flatGraph.outEnd(a->getId()); p++)
     {
-        SDFport *p = *iter;
-        SDFchannel *c = p->getChannel();
-        
-        // Actor is source of the channel?
-        if (p->getType() == SDFport::Out)
-        {
-            PRODUCE(c->getId(), p->getRate());
-        }
+        PRODUCE(flatGraph.outChannel(p), flatGraph.outRate(p));
     }
 
     // Remove the firing from the list of active actor firings
@@ -38,6 +38,8 @@
 #define SDF_RESOURCE_ALLOCATION_SCHEDULING_STATIC_PERIODIC_SCHEDULER_H_INCLUDED
 
 #include "../../base/timed/graph.h"
+#include "../../analysis/statespace/state.h"
+#include "../../analysis/statespace/flat_graph.h"
 
 /**
  * Static-Periodic Scheduler
@@ -92,6 +94,9 @@ private:
             // Clear state
             void clear();
 
+            // Encode the state into a compact state
+            void pack(SDFcompactState &s) const;
+
             // Output state
             void print(ostream &out);
 
@@ -101,13 +106,13 @@ private:
             unsigned long glbClk;
         };
 
-        // Sequence of states in transition system        
-        typedef list<State>      States;
-        typedef States::iterator StatesIter;
+        // Position of a state in the transition system
+        typedef SDFstatePos StatesIter;
 
         // Constructor
         TransitionSystem(TimedSDFgraph *gr) {
             g = gr;
+            flatGraph.compile(g);
             initOutputActor();   
         };
         
@@ -149,11 +154,17 @@ private:
         CId outputActor;
         TCnt outputActorRepCnt;
         
+        // Flat execution model of the graph
+        SDFflatGraph flatGraph;
+
         // Current state
         State currentState; 
 
-        // List of visited states that are stored
-        States storedStates;
+        // Visited states that are stored
+        SDFstateStore storedStates;
+
+        // Encoding of the state which is being stored
+        SDFcompactState encodedState;
     };
 };
 
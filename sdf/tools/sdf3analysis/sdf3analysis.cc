@@ -59,6 +59,9 @@ typedef struct _Settings
     
     // Switch argument(s) given to analysis algorithm
     CPairs arguments;
+
+    // Directory for temporary files holding large state spaces ("" = memory)
+    CString spillDir;
     
     // Application graph
     CNode *xmlAppGraph;
@@ -85,10 +88,12 @@ void helpMessage(ostream &out)
     out << "SDF3 " << TOOL << " (version " << DOTTED_VERSION ")" << endl;
     out << endl;
     out << "Usage: " << TOOL << " --graph <file> --algo <algorithm>";
-    out << " [--output <file>]";
+    out << " [--output <file>] [--spill <dir>]";
     out << endl;
     out << "   --graph  <file>     input SDF graph" << endl;
     out << "   --output <file>     output file (default: stdout)" << endl;
+    out << "   --spill <dir>       keep state spaces in temporary files in <dir>";
+    out << endl;
     out << "   --algo <algorithm>  analyze the graph with requested algorithm:";
     out << endl;
     out << "       consistency" << endl;
@@ -103,7 +108,7 @@ void helpMessage(ostream &out)
     out << "       is_hsdf" << endl;              
     out << "       statistics" << endl;              
     out << "       throughput" << endl;              
-    out << "       buffersize" << endl;
+    out << "       buffersize[(nrThreads)]" << endl;
     out << "       buffersize_ning_gao" << endl;           
     out << "       buffersize_capacity_constrained" << endl;           
     out << "       latency(method,srcActor,dstActor)" << endl;
@@ -216,6 +221,11 @@ void parseCommandLine(int argc, char ** argv)
             arg++;
             settings.arguments = parseSwitchArgument(argv[arg]);
         }
+        else if (argv[arg] == CString("--spill") && arg+1<argc)
+        {
+            arg++;
+            settings.spillDir = argv[arg];
+        }
         else
         {
             helpMessage(cerr);
@@ -325,6 +335,9 @@ void initSettings(int argc, char **argv)
     // Parse the command line
     parseCommandLine(argc, argv);
 
+    // State spaces are paged to disk when memory runs short
+    CArena::setSpillDirectory(settings.spillDir);
+
     // Check required settings
     if (settings.graphFile.empty() || settings.arguments.size() == 0)
     {
@@ -451,36 +464,37 @@ void analyzeSDFG(TimedSDFgraph *g, CPairs &analyze, ostream &out)
     else if (analyze.front().key == "mcm")
     {   
         CFraction mcm;
-        TimedSDFgraph *hsdfGraph;
 
         // Measure execution time
         startTimer(&timer);
 
-        hsdfGraph = (TimedSDFgraph*)transformSDFtoHSDF(g);
-
         if (analyze.front().value.empty() || analyze.front().value == "cycle")
         {
+            TimedSDFgraph *hsdfGraph;
+            
+            hsdfGraph = (TimedSDFgraph*)transformSDFtoHSDF(g);
             mcm = maximumCycleMeanCycles(hsdfGraph);
+            delete hsdfGraph;
         }
         else if (analyze.front().value == "dasdan")
         {
-            mcm = maximumCycleMeanDasdanGupta(hsdfGraph);
+            mcm = maximumCycleMeanDasdanGupta(g);
         }
         else if (analyze.front().value == "karp")
         {
-            mcm = maximumCycleMeanKarp(hsdfGraph);
+            mcm = maximumCycleMeanKarp(g);
         }
         else if (analyze.front().value == "howard")
         {
-            mcm = maximumCycleMeanHoward(hsdfGraph);
+            mcm = maximumCycleMeanHoward(g);
         }
         else if (analyze.front().value == "yto")
         {
-            mcm = maximumCycleYoungTarjanOrlin(hsdfGraph, true);
+            mcm = maximumCycleYoungTarjanOrlin(g, true);
         }
         else if (analyze.front().value == "yto-mcr")
         {
-            mcm = maximumCycleYoungTarjanOrlin(hsdfGraph, false);
+            mcm = maximumCycleYoungTarjanOrlin(g, false);
         }
         else
         {
@@ -495,8 +509,6 @@ void analyzeSDFG(TimedSDFgraph *g, CPairs &analyze, ostream &out)
         out << "analysis time: ";
         printTimer(out, &timer);
         out << endl;
-        
-        delete hsdfGraph;
     }
     else if (analyze.front().key == "throughput")
     {   
@@ -572,6 +584,19 @@ void analyzeSDFG(TimedSDFgraph *g, CPairs &analyze, ostream &out)
         StorageDistributionSet *minStorageDistributions;
         SDFstateSpaceBufferAnalysis bufferAnalysisAlgo;
         
+        // Number of threads used to explore the storage distributions
+        if (!analyze.front().value.empty())
+        {
+            int nrThreads = analyze.front().value;
+            
+            if (nrThreads < 1)
+                throw CException("Number of threads must be at least one.");
+            if ((uint)nrThreads > nrProcessorsOnline())
+                nrThreads = nrProcessorsOnline();
+
+            bufferAnalysisAlgo.setNrThreads(nrThreads);
+        }
+        
         minStorageDistributions = bufferAnalysisAlgo.analyze(g);
 
         out << "<?xml version='1.0' encoding='UTF-8'?>" << endl;
@@ -43,6 +43,8 @@
 SDFgraph *transformSDFtoHSDF(SDFgraph *g)
 {
     SDFgraph *h;
+    vector<SDFactor*> firings;
+    v_uint firstFiring(g->nrActors());
     
     // Construct a new (H)SDF graph
     SDFcomponent component = SDFcomponent(NULL, 0);
@@ -56,6 +58,9 @@ SDFgraph *transformSDFtoHSDF(SDFgraph *g)
     {
         SDFactor *gA = *iter;
         
+        // Actor of the first firing of gA in the HSDF graph
+        firstFiring[gA->getId()] = firings.size();
+        
         for (int i = 0; i < repetitionVector[gA->getId()]; i++)
         {
             // Create new actor
@@ -65,6 +70,7 @@ SDFgraph *transformSDFtoHSDF(SDFgraph *g)
             
             // Add actor to graph
             h->addActor(a);
+            firings.push_back(a);
         }
     }
     
@@ -88,8 +94,7 @@ SDFgraph *transformSDFtoHSDF(SDFgraph *g)
         for (uint i = 1; i <= qA; i++)
         {
             // Get pointer to source actor
-            SDFactor *hSrcA = h->getActor(gSrcA->getName() 
-                                + CString("_") + CString(i-1));
+            SDFactor *hSrcA = firings[firstFiring[gSrcA->getId()] + i-1];
             
             for (uint k = 1; k <= nA; k++)
             {
@@ -106,8 +111,7 @@ SDFgraph *transformSDFtoHSDF(SDFgraph *g)
                 hSrcA->addPort(hSrcP);
                 
                 // Create port on destination node
-                SDFactor *hDstA = h->getActor(gDstA->getName()
-                                    + CString("_") + CString(j-1));
+                SDFactor *hDstA = firings[firstFiring[gDstA->getId()] + j-1];
                 component = SDFcomponent(hDstA, hDstA->nrPorts());
                 SDFport *hDstP = gDstP->createCopy(component);
                 hDstP->setName(gDstP->getName()
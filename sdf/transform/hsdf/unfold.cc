@@ -43,6 +43,8 @@
 SDFgraph *unfoldHSDF(SDFgraph *g, const uint N)
 {
     SDFgraph *h;
+    vector<SDFactor*> copies;
+    v_uint firstCopy(g->nrActors());
     
     // Check that graph g is an HSDF graph
     if (!isHSDFgraph(g))
@@ -57,6 +59,9 @@ SDFgraph *unfoldHSDF(SDFgraph *g, const uint N)
     {
         SDFactor *gA = *iter;
         
+        // Actor of the first copy of gA in the unfolded graph
+        firstCopy[gA->getId()] = copies.size();
+        
         // Create N copies of the actor A in G
         for (uint i = 0; i < N; i++)
         {
@@ -81,6 +86,7 @@ SDFgraph *unfoldHSDF(SDFgraph *g, const uint N)
             
             // Add actor to graph
             h->addActor(a);
+            copies.push_back(a);
         }
     }
 
@@ -96,13 +102,13 @@ SDFgraph *unfoldHSDF(SDFgraph *g, const uint N)
         {
             uint k = N + l - d % N;
             
+            // Source and destination actor
+            SDFactor *hSrcA = copies[firstCopy[gC->getSrcActor()->getId()] + k];
+            SDFactor *hDstA = copies[firstCopy[gC->getDstActor()->getId()] + l];
+            
             // Source and destination port
-            SDFport *hSrcP = h->getActor(gC->getSrcActor()->getName() 
-                                            + CString("_") + CString(k)
-                                        )->getPort(gC->getSrcPort()->getName());
-            SDFport *hDstP = h->getActor(gC->getDstActor()->getName() 
-                                            + CString("_") + CString(l)
-                                        )->getPort(gC->getDstPort()->getName());
+            SDFport *hSrcP = hSrcA->getPort(gC->getSrcPort()->getName());
+            SDFport *hDstP = hDstA->getPort(gC->getDstPort()->getName());
             
             // Create channel c
             component = SDFcomponent(h, h->nrChannels());
@@ -123,13 +129,13 @@ SDFgraph *unfoldHSDF(SDFgraph *g, const uint N)
         {
             uint k = l - d % N;
 
+            // Source and destination actor
+            SDFactor *hSrcA = copies[firstCopy[gC->getSrcActor()->getId()] + k];
+            SDFactor *hDstA = copies[firstCopy[gC->getDstActor()->getId()] + l];
+            
             // Source and destination port
-            SDFport *hSrcP = h->getActor(gC->getSrcActor()->getName() 
-                                            + CString("_") + CString(k)
-                                        )->getPort(gC->getSrcPort()->getName());
-            SDFport *hDstP = h->getActor(gC->getDstActor()->getName() 
-                                            + CString("_") + CString(l)
-                                        )->getPort(gC->getDstPort()->getName());
+            SDFport *hSrcP = hSrcA->getPort(gC->getSrcPort()->getName());
+            SDFport *hDstP = hDstA->getPort(gC->getDstPort()->getName());
             
             // Create channel c
             component = SDFcomponent(h, h->nrChannels());